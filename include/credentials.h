@@ -15,7 +15,11 @@ void creds_get(const char *key, char *buf, size_t len);
 static inline void creds_set_ssid    (const char *val)              { creds_set("ssid",     val); }
 static inline void creds_set_password(const char *val)              { creds_set("password", val); }
 static inline void creds_set_url     (const char *val)              { creds_set("url",      val); }
+static inline void creds_set_profile (const char *val)              { creds_set("profile",  val); }
+static inline void creds_set_resolution(const char *val)            { creds_set("resolution", val); }
 
 static inline void creds_get_ssid    (char *buf, size_t len)        { creds_get("ssid",     buf, len); }
 static inline void creds_get_password(char *buf, size_t len)        { creds_get("password", buf, len); }
 static inline void creds_get_url     (char *buf, size_t len)        { creds_get("url",      buf, len); }
+static inline void creds_get_profile (char *buf, size_t len)        { creds_get("profile",  buf, len); }
+static inline void creds_get_resolution(char *buf, size_t len)      { creds_get("resolution", buf, len); }
@@ -0,0 +1,54 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// What the host does with the volume, posted by the USB callbacks (TinyUSB task) for the fetch task
+//
+// Single producer, single consumer ring: push from one task only, pop from one task only. Neither waits
+// for the other, head and tail are each written by one side and read by the other with acquire/release
+// ordering, so an event is complete before it becomes visible. A full queue drops the new event and
+// counts it, the USB callbacks never block.
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 32
+#endif
+#if (EVENT_QUEUE_SIZE < 2) || (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1))
+#error "EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+enum storage_event_type
+{
+    STORAGE_EV_SLOT_OPENED,     // host read the first sector of image slot
+    STORAGE_EV_SLOT_FINISHED,   // host read the last sector of the image in slot, arg: reads since it opened it
+    STORAGE_EV_DIR_READ,        // host read the root directory (mount, rescan)
+    STORAGE_EV_START_STOP,      // SCSI START STOP UNIT, arg: power condition << 2 | start << 1 | load/eject
+    STORAGE_EV_TYPES
+};
+
+struct storage_event
+{
+    uint32_t t_ms;      // millis() when it happened
+    uint16_t type;      // enum storage_event_type
+    uint16_t slot;      // image slot, for the slot events
+    uint32_t arg;
+};
+
+struct event_queue
+{
+    struct storage_event ev[EVENT_QUEUE_SIZE];
+    uint32_t head;      // next to pop, written by the consumer
+    uint32_t tail;      // next to push, written by the producer
+    uint32_t dropped;   // events pushed while full, written by the producer
+};
+
+// Producer side. false: queue full, the event was dropped
+bool event_queue_push(struct event_queue *q, const struct storage_event *ev);
+// Consumer side. false: queue empty
+bool event_queue_pop(struct event_queue *q, struct storage_event *ev);
+uint32_t event_queue_dropped(const struct event_queue *q);
+
+#ifdef __cplusplus
+}
+#endif
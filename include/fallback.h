@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fallback images compiled into the firmware as a bundle of LZ4 packed 4 KB blocks
+// (src/fallback_bundle.c, built from fallback/*.jpg by tools/mkbundle.py).
+// They fill the slots at boot and take turns while there is neither network nor a cached image.
+
+// Number of images in the bundle, 0 if it is missing or damaged
+uint32_t fallback_count(void);
+// Unpacked length of image number image, 0 if there is no such image
+uint32_t fallback_size(uint32_t image);
+// Flash taken by the bundle, in bytes
+uint32_t fallback_bundle_size(void);
+// Unpack block number block (STORAGE_IMG_BLOCK bytes each) of image into out.
+// Returns the number of bytes unpacked, 0 beyond the end of the image or if the block is corrupt
+uint32_t fallback_read_block(uint32_t image, uint32_t block, void * out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,287 @@
+#pragma once
+// Compile-time builder for the virtual FAT16 volume
+//
+// Takes a list of files (8.3 name, slot size) and produces the MBR, VBR, FAT,
+// root directory and the LBA of every file as constant expressions.
+// Files are laid out back to back in cluster order, each as one contiguous chain.
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+#include "storage.h"
+
+namespace fat16
+{
+
+// A file of the volume. size is the slot size, i.e. what gets allocated on the volume
+struct file
+{
+    const char * name;  // "NAME.EXT"
+    uint32_t size;      // bytes
+};
+
+// Where a file lives on the disk
+struct file_map
+{
+    uint32_t lba;       // first sector
+    uint32_t sectors;   // number of sectors
+    uint16_t cluster;   // first cluster
+    uint16_t clusters;  // number of clusters
+};
+
+// Geometry of the volume. Defaults reproduce the stick `mkfs.fat -F 16` formatted (see layout.txt)
+struct params
+{
+    uint32_t disk_sectors        = 64 * 1024;   // size reported to the host
+    uint32_t partition_lba       = 2048;
+    uint32_t partition_sectors   = 32768;
+    uint8_t  sectors_per_cluster = 4;
+    uint16_t reserved_sectors    = 4;
+    uint8_t  num_fats            = 2;
+    uint16_t root_entries        = 512;
+    uint16_t first_cluster       = 3;           // mkfs.fat left cluster 2 unused
+    uint8_t  media               = 0xF8;
+    uint16_t sectors_per_track   = 32;
+    uint16_t heads               = 64;
+    uint32_t volume_id           = 0xF81E732E;
+    uint16_t date                = ((2026 - 1980) << 9) | (2 << 5) | 19;   // 2026-02-19
+    uint16_t time                = (18 << 11) | (0 << 5) | (0 / 2);       // 18:00:00
+};
+
+template <size_t N>
+struct layout
+{
+    params p;
+    uint32_t sectors_per_fat;
+    uint32_t fat_lba[2];        // first sector of FAT #1 and FAT #2
+    uint32_t root_lba;          // first sector of the root directory
+    uint32_t root_sectors;      // sectors reserved for the root directory
+    uint32_t data_lba;          // first sector of cluster 2
+    uint32_t clusters;          // number of data clusters
+    uint32_t fat_used_sectors;  // FAT sectors holding entries other than free
+    file files[N];
+    file_map map[N];
+};
+
+
+constexpr uint32_t div_up(uint32_t a, uint32_t b)
+{
+    return (a + b - 1) / b;
+}
+
+constexpr void put16(uint8_t * d, uint16_t v)
+{
+    d[0] = (uint8_t)v;
+    d[1] = (uint8_t)(v >> 8);
+}
+
+constexpr void put32(uint8_t * d, uint32_t v)
+{
+    put16(d, (uint16_t)v);
+    put16(d + 2, (uint16_t)(v >> 16));
+}
+
+constexpr void put_str(uint8_t * d, const char * s, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        d[i] = s[i];
+    }
+}
+
+// "IMG1.JPG" -> "IMG1    JPG"
+constexpr void put_name(uint8_t * d, const char * name)
+{
+    for (size_t i = 0; i < 11; i++)
+    {
+        d[i] = ' ';
+    }
+    size_t i = 0;
+    size_t o = 0;
+    for (; (name[i] != '\0') && (name[i] != '.') && (o < 8); i++)
+    {
+        d[o++] = name[i];
+    }
+    while ((name[i] != '\0') && (name[i] != '.'))
+    {
+        i++;
+    }
+    if (name[i] == '.')
+    {
+        i++;
+    }
+    for (o = 8; (name[i] != '\0') && (o < 11); i++)
+    {
+        d[o++] = name[i];
+    }
+}
+
+
+template <size_t N>
+constexpr layout<N> make_layout(const std::array<file, N> & files, const params & p = params())
+{
+    layout<N> l{};
+    l.p = p;
+    l.root_sectors = div_up(p.root_entries * 32, DISK_SECTOR_SIZE);
+
+    // Same fixpoint mkfs.fat uses: the FAT must hold an entry for every cluster that fits behind it
+    uint32_t spf = 1;
+    for (;;)
+    {
+        const uint32_t data = p.partition_sectors - p.reserved_sectors - p.num_fats * spf - l.root_sectors;
+        const uint32_t need = div_up((data / p.sectors_per_cluster + 2) * 2, DISK_SECTOR_SIZE);
+        if (need <= spf)
+        {
+            break;
+        }
+        spf = need;
+    }
+    l.sectors_per_fat = spf;
+    l.fat_lba[0] = p.partition_lba + p.reserved_sectors;
+    l.fat_lba[1] = l.fat_lba[0] + spf;
+    l.root_lba = p.partition_lba + p.reserved_sectors + p.num_fats * spf;
+    l.data_lba = l.root_lba + l.root_sectors;
+    l.clusters = (p.partition_sectors - (l.data_lba - p.partition_lba)) / p.sectors_per_cluster;
+
+    const uint32_t cluster_size = p.sectors_per_cluster * DISK_SECTOR_SIZE;
+    uint32_t cluster = p.first_cluster;
+    for (size_t i = 0; i < N; i++)
+    {
+        l.files[i] = files[i];
+        l.map[i].cluster = (uint16_t)cluster;
+        l.map[i].clusters = (uint16_t)div_up(files[i].size, cluster_size);
+        l.map[i].lba = l.data_lba + (cluster - 2) * p.sectors_per_cluster;
+        l.map[i].sectors = l.map[i].clusters * p.sectors_per_cluster;
+        cluster += l.map[i].clusters;
+    }
+    l.fat_used_sectors = div_up(cluster * 2, DISK_SECTOR_SIZE);
+    return l;
+}
+
+// Check a layout for what FAT16 and the host can digest
+template <size_t N>
+constexpr bool is_valid(const layout<N> & l)
+{
+    const uint32_t last = (N > 0) ? (l.map[N - 1].cluster + l.map[N - 1].clusters) : l.p.first_cluster;
+    return (l.clusters >= 4085) && (l.clusters < 65525)         // FAT16 by cluster count
+        && (N <= l.p.root_entries)
+        && (last <= l.clusters + 2)
+        && (l.fat_used_sectors <= l.sectors_per_fat)
+        && (l.p.partition_lba + l.p.partition_sectors <= l.p.disk_sectors);
+}
+
+
+// CHS address of an LBA, packed the way the partition table wants it
+constexpr void put_chs(uint8_t * d, uint32_t lba, const params & p)
+{
+    const uint32_t per_cyl = (uint32_t)p.heads * p.sectors_per_track;
+    uint32_t c = lba / per_cyl;
+    const uint32_t h = (lba / p.sectors_per_track) % p.heads;
+    const uint32_t s = lba % p.sectors_per_track + 1;
+    if (c > 1023)
+    {
+        c = 1023;
+    }
+    d[0] = (uint8_t)h;
+    d[1] = (uint8_t)(s | ((c >> 2) & 0xC0));
+    d[2] = (uint8_t)c;
+}
+
+// Master Boot Record, one FAT16 partition
+template <size_t N>
+constexpr std::array<uint8_t, DISK_SECTOR_SIZE> make_mbr(const layout<N> & l)
+{
+    std::array<uint8_t, DISK_SECTOR_SIZE> s{};
+    uint8_t * e = &s[446];
+    e[0] = 0x00;                                                // not bootable
+    put_chs(&e[1], l.p.partition_lba, l.p);
+    e[4] = 0x06;                                                // FAT16 (>= 32 MB)
+    put_chs(&e[5], l.p.partition_lba + l.p.partition_sectors - 1, l.p);
+    put32(&e[8], l.p.partition_lba);
+    put32(&e[12], l.p.partition_sectors);
+    s[510] = 0x55;
+    s[511] = 0xAA;
+    return s;
+}
+
+// Volume Boot Record with BPB and FAT16 extended boot record
+template <size_t N>
+constexpr std::array<uint8_t, DISK_SECTOR_SIZE> make_vbr(const layout<N> & l)
+{
+    std::array<uint8_t, DISK_SECTOR_SIZE> s{};
+    s[0] = 0xEB; s[1] = 0x3C; s[2] = 0x90;                      // JMP SHORT 0x3E, NOP
+    put_str(&s[3], "mkfs.fat", 8);
+    put16(&s[11], DISK_SECTOR_SIZE);
+    s[13] = l.p.sectors_per_cluster;
+    put16(&s[14], l.p.reserved_sectors);
+    s[16] = l.p.num_fats;
+    put16(&s[17], l.p.root_entries);
+    put16(&s[19], (l.p.partition_sectors < 0x10000) ? (uint16_t)l.p.partition_sectors : 0);
+    s[21] = l.p.media;
+    put16(&s[22], (uint16_t)l.sectors_per_fat);
+    put16(&s[24], l.p.sectors_per_track);
+    put16(&s[26], l.p.heads);
+    put32(&s[28], l.p.partition_lba);                           // hidden sectors
+    put32(&s[32], (l.p.partition_sectors < 0x10000) ? 0 : l.p.partition_sectors);
+    s[36] = 0x80;                                               // drive number
+    s[38] = 0x29;                                               // extended boot signature
+    put32(&s[39], l.p.volume_id);
+    put_str(&s[43], "NO NAME    ", 11);
+    put_str(&s[54], "FAT16   ", 8);
+    s[62] = 0xF4; s[63] = 0xEB; s[64] = 0xFD;                   // HLT, JMP $-1
+    s[510] = 0x55;
+    s[511] = 0xAA;
+    return s;
+}
+
+// Chain of used clusters starting at first, the rest of the allocated clusters free
+constexpr void put_chain(uint8_t * fat, size_t fat_size, uint32_t first, uint32_t used, uint32_t allocated)
+{
+    for (uint32_t c = first; (c < first + allocated) && (2 * c + 1 < fat_size); c++)
+    {
+        const uint32_t n = c - first + 1;
+        put16(&fat[2 * c], (n < used) ? (uint16_t)(c + 1) : (n == used) ? 0xFFFF : 0x0000);
+    }
+}
+
+// Leading S sectors of the FAT, one contiguous chain per file
+template <size_t S, size_t N>
+constexpr std::array<uint8_t, S * DISK_SECTOR_SIZE> make_fat(const layout<N> & l)
+{
+    std::array<uint8_t, S * DISK_SECTOR_SIZE> s{};
+    put16(&s[0], 0xFF00 | l.p.media);
+    put16(&s[2], 0xFFFF);
+    for (size_t i = 0; i < N; i++)
+    {
+        put_chain(s.data(), s.size(), l.map[i].cluster, l.map[i].clusters, l.map[i].clusters);
+    }
+    return s;
+}
+
+// Directory entry of file i, with the given file size
+template <size_t N>
+constexpr void put_dir_entry(uint8_t * d, const layout<N> & l, size_t i, uint32_t size)
+{
+    put_name(&d[0], l.files[i].name);
+    d[11] = 0x20;                                               // archive
+    put16(&d[14], l.p.time);                                    // created
+    put16(&d[16], l.p.date);
+    put16(&d[18], l.p.date);                                    // last access
+    put16(&d[22], l.p.time);                                    // modified
+    put16(&d[24], l.p.date);
+    put16(&d[26], l.map[i].cluster);
+    put32(&d[28], size);
+}
+
+// Leading S sectors of the root directory, one entry per file
+template <size_t S, size_t N>
+constexpr std::array<uint8_t, S * DISK_SECTOR_SIZE> make_rootdir(const layout<N> & l)
+{
+    std::array<uint8_t, S * DISK_SECTOR_SIZE> s{};
+    for (size_t i = 0; (i < N) && (32 * (i + 1) <= s.size()); i++)
+    {
+        put_dir_entry(&s[32 * i], l, i, l.files[i].size);
+    }
+    return s;
+}
+
+} // namespace fat16
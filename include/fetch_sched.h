@@ -0,0 +1,54 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// When to download the next image, learned from how the frame reads them
+//
+// The frame opens one image after the other at its slide interval, 5 s to 10 min depending on the model.
+// The interval between image opens and the time a download takes are both tracked as EWMA (1/4 weight
+// to the newest sample) along with their mean deviation, the way TCP estimates round trip times.
+// A download for the slot ahead starts when it would finish just before the frame is predicted to
+// open that slot, with a margin of a few deviations: the image is as fresh as it can be, and WiFi
+// stays idle in between.
+// Until two opens have been seen the download starts FETCH_SCHED_DELAY_MS after an open, as before.
+// All times are in ms of a free running clock (millis()), differences taken modulo 2^32
+
+#ifndef FETCH_SCHED_DELAY_MS
+#define FETCH_SCHED_DELAY_MS 500
+#endif
+// Opens closer than this are the host browsing (mount, thumbnails), not a slide interval
+#ifndef FETCH_SCHED_MIN_INTERVAL_MS
+#define FETCH_SCHED_MIN_INTERVAL_MS 1000
+#endif
+// Added to the margin, for the host reading the image and the loop noticing the schedule
+#ifndef FETCH_SCHED_GUARD_MS
+#define FETCH_SCHED_GUARD_MS 500
+#endif
+
+struct fetch_sched_stats
+{
+    uint32_t opens;             // image opens seen
+    uint32_t interval_ms;       // estimated slide interval, 0: not learned yet
+    uint32_t interval_dev_ms;   // its mean deviation
+    uint32_t download_ms;       // estimated download time, 0: none measured yet
+    uint32_t download_dev_ms;
+    uint32_t predictions;       // opens that had been predicted
+    int32_t last_error_ms;      // open time minus predicted open time, the latest (< 0: early)
+    uint32_t mean_abs_error_ms; // mean of |error| over all predictions
+};
+
+// Host opened an image at now (the next one in the ring, not the same again)
+void fetch_sched_opened(uint32_t now);
+// A download took ms
+void fetch_sched_downloaded(uint32_t ms);
+// ms to wait before starting the download for the slot ahead steps ahead of the one opened last, 0: start now
+uint32_t fetch_sched_wait(uint32_t now, uint32_t ahead);
+void fetch_sched_stats(struct fetch_sched_stats *stats);
+void fetch_sched_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,8 +1,60 @@
 #pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
+
+// The fetch pipeline runs in a FreeRTOS task of its own (HTTP_FETCH_TASK), on the core of the WiFi stack,
+// so a download never stalls loop() and the CLI. Commands go to it and results come back through queues.
+// HTTP_FETCH_TASK=0 runs it from loop() as http_client_process(), as before
+#ifndef HTTP_FETCH_TASK
+#define HTTP_FETCH_TASK 1
+#endif
+
+enum http_command
+{
+    HTTP_CMD_FETCH_NOW,     // top up the ring right away, whatever the schedule says
+    HTTP_CMD_PAUSE,         // no downloads until resumed
+    HTTP_CMD_RESUME,
+};
+
+// Where the image put into a slot came from
+enum http_source
+{
+    HTTP_FROM_SERVER,
+    HTTP_FROM_CACHE,
+    HTTP_FROM_FALLBACK,
+    HTTP_FROM_NONE,         // download failed, slot left as it was
+    HTTP_UNCHANGED,         // server still has the image the slot holds (304, same ETag or same bytes), slot kept
+    HTTP_OVERSIZE,          // server sent an image bigger than X-Max-Bytes, not downloaded, slot kept
+};
+
+struct http_result
+{
+    uint32_t slot;
+    uint32_t source;        // enum http_source
+    uint32_t bytes;         // image size, 0 unless from the server
+    uint32_t ms;            // download time
+};
+
+// Restores cached images into the slots, then starts the fetch task
+void http_client_begin(void);
+// One pass of the fetch pipeline: take commands and host events, start a download if one is due.
+// The fetch task's body; call it from loop() if HTTP_FETCH_TASK is 0
 void http_client_process(void);
+// Queue a command for the fetch task. false: queue full
+bool http_client_command(enum http_command cmd);
+// Next result of the fetch task, false: none
+bool http_client_result(struct http_result *result);
+void http_client_task_status(char *buf, size_t len);
+void http_client_cache_status(char *buf, size_t len);
+// Connection reuse and setup time
+void http_client_conn_status(char *buf, size_t len);
+// Conditional requests (ETag, Last-Modified), fetches avoided and bytes saved, images refused as too big
+void http_client_cond_status(char *buf, size_t len);
+void http_client_sched_status(char *buf, size_t len);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,81 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Persistent cache of fetched images in a flash partition
+//
+// Content addressed (FNV-1a 64 of the image) and log structured: images are appended behind
+// each other in whole erase sectors, the oldest ones are erased when the log wraps around.
+// Flash is never rewritten in place, so erases spread evenly over the partition.
+// Images read back from the older half of the log are appended again, so eviction follows
+// last use (LRU) rather than insertion order.
+// If the partition is memory mapped, cached images can be served straight from flash:
+// image_cache_map() hands out a pointer into the mapping, image_cache_pin() keeps the log from erasing it.
+
+#define IMAGE_CACHE_SECTOR      4096        // erase unit
+#ifndef IMAGE_CACHE_MAX_ENTRIES
+#define IMAGE_CACHE_MAX_ENTRIES 128         // images indexed in RAM
+#endif
+
+// Flash the cache lives in. Functions return 0 on success
+struct cache_flash
+{
+    uint32_t size;      // bytes, a multiple of IMAGE_CACHE_SECTOR
+    int (* read)(void * ctx, uint32_t addr, void * buf, uint32_t len);
+    int (* write)(void * ctx, uint32_t addr, const void * buf, uint32_t len);  // only clears bits
+    int (* erase)(void * ctx, uint32_t addr, uint32_t len);                    // whole sectors, sets to 0xFF
+    void * ctx;
+    const uint8_t * map;    // whole partition mapped read-only into the address space, NULL if not
+};
+
+struct image_cache_stats
+{
+    uint32_t entries;   // images cached
+    uint32_t bytes;     // image bytes cached
+    uint32_t size;      // partition size
+    uint32_t puts;      // images written
+    uint32_t dedups;    // puts skipped, image already cached
+    uint32_t reads;     // images read back
+    uint32_t maps;      // images mapped
+    uint32_t moves;     // images appended again on read
+    uint32_t evictions; // images erased to make room
+    uint32_t erases;    // sectors erased
+};
+
+// Scan the flash for cached images. Returns the number of images found, -1 on error
+int image_cache_mount(const struct cache_flash * flash);
+// Content address of an image
+uint64_t image_cache_hash(const void * data, uint32_t len);
+// Store an image, unless an identical one is cached already. Returns 0 on success
+int image_cache_put(const void * data, uint32_t len);
+// Content addresses of the cached images, most recently used first. Returns their number
+uint32_t image_cache_list(uint64_t * hashes, uint32_t max);
+// Read image hash into buf. Returns its length, 0 if not cached, bigger than size or corrupt
+uint32_t image_cache_read(uint64_t hash, void * buf, uint32_t size);
+void image_cache_stats(struct image_cache_stats * stats);
+
+// Streamed put, for images bigger than any RAM buffer: announce len, write the image in pieces, commit.
+// Returns 0 on success, any failure ends the put
+int image_cache_begin(uint32_t len);
+int image_cache_write(const void * data, uint32_t len);
+// Bytes written so far, in the mapping (NULL if not mapped or no put in progress)
+const void * image_cache_pending(void);
+// Store the image, hash receives its content address. An image cached already is kept just once
+int image_cache_commit(uint64_t * hash);
+void image_cache_cancel(void);
+
+// Image hash in the mapped partition. Returns its length, 0 if not cached, corrupt or not mapped
+uint32_t image_cache_map(uint64_t hash, const void ** data);
+// Keep the log from erasing image hash while it is mapped (pin), or let it go again
+void image_cache_pin(uint64_t hash, bool pin);
+
+// Flash partition with the given label, mapped if the MMU has room (firmware only, see image_cache_flash.c).
+// Returns 0 on success
+int image_cache_partition(struct cache_flash * flash, const char * label);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Trace of the host's sector accesses: every onRead/onWrite call with a timestamp, in a ring buffer of
+// LBA_TRACE_ENTRIES (a power of two, 0: no tracing) that keeps the latest LBA_TRACE_ENTRIES - 1.
+// One writer (the USB task) and any number of readers, neither ever waits for the other:
+// a reader just finds out afterwards whether the entry it copied was overwritten meanwhile
+#ifndef LBA_TRACE_ENTRIES
+#define LBA_TRACE_ENTRIES 512
+#endif
+#if LBA_TRACE_ENTRIES & (LBA_TRACE_ENTRIES - 1)
+#error "LBA_TRACE_ENTRIES must be a power of two"
+#endif
+
+enum lba_trace_op
+{
+    LBA_TRACE_READ,
+    LBA_TRACE_WRITE,
+};
+
+// 16 bytes, also the record of the binary export (little endian)
+struct lba_trace_entry
+{
+    uint32_t t_us;      // micros() at the call
+    uint32_t lba;
+    uint16_t bufsize;   // bytes asked for
+    uint16_t offset;    // byte offset into the sector at lba
+    uint16_t result;    // bytes returned (read: fewer while a streamed image is arriving)
+    uint8_t op;         // enum lba_trace_op
+    uint8_t reserved;
+};
+
+// Binary export: this header, then count entries oldest first.
+// The serial CLI sends it as hex lines, tools/replay_trace reads those back
+#define LBA_TRACE_MAGIC "LBAT"
+#define LBA_TRACE_VERSION 1
+struct lba_trace_header
+{
+    char magic[4];          // LBA_TRACE_MAGIC
+    uint16_t version;       // LBA_TRACE_VERSION
+    uint16_t entry_size;    // sizeof(struct lba_trace_entry)
+    uint32_t count;         // entries that follow
+    uint32_t first;         // sequence number of the first one, entries before it were overwritten
+};
+
+void lba_trace_record(uint32_t t_us, enum lba_trace_op op, uint32_t lba, uint32_t offset, uint32_t bufsize, uint32_t result);
+// Entries recorded so far: the next sequence number. The ring holds [end - LBA_TRACE_ENTRIES + 1, end)
+uint32_t lba_trace_end(void);
+// Copy entry number seq. false if it is not (or no longer) in the ring
+bool lba_trace_get(uint32_t seq, struct lba_trace_entry *entry);
+// Drop all entries
+void lba_trace_clear(void);
+// Stop (false) or resume recording. The export stops it meanwhile, so the entries it sends stay put
+void lba_trace_enable(bool on);
+bool lba_trace_enabled(void);
+
+// Binary export as text lines for a serial console: a begin marker, header and entries in hex, 32 bytes
+// per line, an end marker. emit gets each line without line end. Returns the number of entries exported
+#define LBA_TRACE_BEGIN "-----BEGIN LBA TRACE-----"
+#define LBA_TRACE_END   "-----END LBA TRACE-----"
+uint32_t lba_trace_export(void (*emit)(const char *line, void *ctx), void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
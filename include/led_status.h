@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Status LED, drawn by a task of its own
+//
+// Showing a colour bit-bangs the APA102, which takes long enough to be felt in a USB read callback.
+// Callers only store the state in an atomic, from any task; the LED task picks it up every LED_FRAME_MS
+// and draws it, animations included. A state set more than once per frame shows the last one.
+#ifndef LED_FRAME_MS
+#define LED_FRAME_MS 20
+#endif
+
+enum led_state
+{
+    LED_IDLE,           // red: nothing read yet, or host stopped the unit / medium back
+    LED_CREDS,          // yellow: host read CREDS.JSN
+    LED_SLOT_EVEN,      // green: host opened IMG1.JPG, IMG3.JPG, ...
+    LED_SLOT_ODD,       // blue: host opened IMG2.JPG, IMG4.JPG, ...
+    LED_MEDIA_AWAY,     // purple: media change pulse (usb_msc_process)
+    LED_FETCHING,       // orange, brighter as the download progresses, breathing if its size is unknown
+    LED_ERROR,          // red blinking for LED_ERROR_MS after a failed download
+    LED_STATES
+};
+
+// Sets up the LED and starts the task
+void led_status_begin(void);
+// What the host did last (LED_IDLE ... LED_MEDIA_AWAY). Never blocks
+void led_status_set(enum led_state state);
+// Download in progress, done of total bytes, total 0: size unknown. Shown over the host state
+void led_status_fetch(uint32_t done, uint32_t total);
+// Download over, false blinks LED_ERROR
+void led_status_fetch_end(bool ok);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LZ4 block format (no frame, no checksum), for blocks of up to 64 KB
+//
+// The compressor is the plain greedy single-pass variant with a small hash table:
+// fast and without heap, at a somewhat lower ratio than the reference implementation.
+// The decompressor checks every length and offset, corrupt input never reads or writes out of bounds.
+
+// Compress len bytes of src into dst. Returns the compressed size, 0 if it does not fit into cap bytes
+uint32_t lz4_block_compress(const uint8_t * src, uint32_t len, uint8_t * dst, uint32_t cap);
+// Decompress len bytes of src into dst. Returns the decompressed size, 0 if src is corrupt or dst too small
+uint32_t lz4_block_decompress(const uint8_t * src, uint32_t len, uint8_t * dst, uint32_t cap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISK_SECTOR_SIZE (512)
+
+// Contiguous LBA range of the virtual disk and the bytes backing it
+struct lba_extent
+{
+    uint32_t lba;                   // first LBA
+    uint32_t count;                 // number of sectors
+    const unsigned char * data;     // backing bytes (RAM or flash)
+    uint32_t len;                   // number of backing bytes, the rest of the extent reads as zeros
+    // Optional read hook, replaces the plain copy of data. Offset in bytes, bufsize a multiple of DISK_SECTOR_SIZE
+    uint32_t (* read)(const struct lba_extent * ext, uint32_t offset, void * buffer, uint32_t bufsize);
+};
+
+// LBA map of the virtual disk, sorted by LBA (generated in volume.cpp)
+// Sectors not covered by any extent read as zeros
+extern struct lba_extent * const DISK_EXTENTS;
+extern const uint32_t DISK_EXTENTS_NUM;
+
+// Number of image files IMG1.JPG ... on the volume
+extern const uint32_t VOLUME_IMAGES;
+
+// Extent of image file number image (0: IMG1.JPG)
+struct lba_extent *volume_image_extent(uint32_t image);
+
+// Name of the structure or file holding lba ("MBR", "FAT1", "ROOTDIR", "IMG2.JPG", ...) and the sector
+// within it. NULL for sectors outside all of them
+const char *volume_lba_name(uint32_t lba, uint32_t *sector);
+
+// Size image file number image to len bytes
+// Root directory entry and FAT chain follow len, so the host only reads what holds data
+void volume_set_image_size(uint32_t image, uint32_t len);
+
+// bufsize is expected to be a multiple of DISK_SECTOR_SIZE
+// Returns the number of bytes read, less than bufsize (whole sectors) where a streamed image has not arrived yet
+uint32_t get_lba_slice(uint32_t lba, void *buffer, uint32_t bufsize);
+uint32_t set_lba_slice(uint32_t lba, const void *data, uint32_t len);
+
+// Ring of image slots IMG1.JPG ... IMGn.JPG (STORAGE_IMG_SLOTS, up to 16), each serving its own buffer
+// of STORAGE_IMG_SIZE. STORAGE_IMG_PREFETCH slots ahead of the one the host opened last are kept ready.
+// STORAGE_IMG_BACK_SIZE adds a spare buffer: downloads that fit it are published by an atomic
+// pointer swap, everything else refills the slot's buffer in place. 0: no spare
+#ifndef STORAGE_IMG_SLOTS
+#define STORAGE_IMG_SLOTS 2
+#endif
+#ifndef STORAGE_IMG_PREFETCH
+#define STORAGE_IMG_PREFETCH 1
+#endif
+#if (STORAGE_IMG_PREFETCH < 1) || (STORAGE_IMG_PREFETCH >= STORAGE_IMG_SLOTS)
+#error "STORAGE_IMG_PREFETCH must be at least 1 and less than STORAGE_IMG_SLOTS"
+#endif
+#ifndef STORAGE_IMG_SIZE
+#define STORAGE_IMG_SIZE (128 * 1024)
+#endif
+// Size of the image files on the volume. Images beyond STORAGE_IMG_SIZE can only be served from mapped flash
+#ifndef STORAGE_IMG_FILE_SIZE
+#define STORAGE_IMG_FILE_SIZE STORAGE_IMG_SIZE
+#endif
+#ifndef STORAGE_IMG_BACK_SIZE
+#define STORAGE_IMG_BACK_SIZE 0
+#endif
+// Packed slots: RAM buffers hold images as LZ4 compressed blocks of STORAGE_IMG_BLOCK bytes, host reads
+// decompress just the blocks they touch. STORAGE_IMG_BLOCK_CACHE decompressed blocks are kept for reads
+// that straddle blocks or come back. Blocks that don't shrink are stored as is. 0: images stored as they are
+#ifndef STORAGE_IMG_PACKED
+#define STORAGE_IMG_PACKED 0
+#endif
+#define STORAGE_IMG_BLOCK 4096
+#ifndef STORAGE_IMG_BLOCK_CACHE
+#define STORAGE_IMG_BLOCK_CACHE 2
+#endif
+
+struct image_buf
+{
+    unsigned char *data;
+    uint32_t size;      // capacity, 0: read-only (mapped flash)
+    uint32_t len;       // valid bytes, fixed while published
+    uint32_t avail;     // bytes arrived so far, less than len while the image streams in
+    uint32_t stored;    // bytes of data taken by the image, less than len if packed
+    uint32_t gen;       // changes with every publish
+};
+
+// Buffer to download the next image of slot into, preferably one that holds size_hint bytes (0: unknown)
+// Returns the slot's front buffer itself if there is no spare buffer big enough, emptied first:
+// the host reads an empty file until the new image is published
+struct image_buf *storage_image_acquire(uint32_t slot, uint32_t size_hint);
+// Add len bytes to the image in the buffer acquired last, packing them if STORAGE_IMG_PACKED.
+// Returns 0 on success, -1 once the buffer is full. Unpacked buffers may also be written through data directly
+int storage_image_append(struct image_buf *buf, const void *data, uint32_t len);
+// Make the first len bytes of buf what the host reads from slot, with a single atomic pointer swap.
+// For packed buffers len is the number of bytes appended.
+// Returns once the slot's previous buffer is no longer read
+void storage_image_publish(uint32_t slot, struct image_buf *buf, uint32_t len);
+// Unpack fallback image number image (fallback.h) into slot. Returns false if it doesn't fit
+bool storage_image_fallback(uint32_t slot, uint32_t image);
+// Copy block number block (STORAGE_IMG_BLOCK bytes each) of the image in buf to out, unpacking it.
+// Returns the number of bytes copied, 0 beyond the end of the image
+uint32_t storage_image_read_block(const struct image_buf *buf, uint32_t block, void *out);
+// Serve len bytes of read-only memory (mapped flash) from slot, without copying them.
+// data must stay valid until the slot is published anew
+void storage_image_publish_mapped(uint32_t slot, const void *data, uint32_t len);
+// Stream-through: serve len bytes of read-only memory from slot while they are still being written.
+// Host reads stop short of what has not arrived, storage_image_stream_progress() moves that mark.
+// Finish with a publish (complete) or by publishing an empty image (failed)
+void storage_image_stream(uint32_t slot, const void *data, uint32_t len);
+void storage_image_stream_progress(uint32_t slot, uint32_t avail);
+// Mark slot as being downloaded into without a buffer of its own (acquire does that, too)
+void storage_image_fetching(uint32_t slot);
+// Download into buf (NULL: none) failed, written bytes (if any) were discarded
+void storage_image_abort(uint32_t slot, struct image_buf *buf);
+// Buffer currently served to the host from slot
+struct image_buf *storage_image_front(uint32_t slot);
+// Call hook (NULL: none) whenever what the host reads from slot changes: every publish, and a refill in place
+// that failed. It runs in the caller of publish/abort, after the volume shows the new size
+void storage_image_on_publish(void (*hook)(uint32_t slot));
+// RAM taken by image buffers, in bytes
+uint32_t storage_image_mem(void);
+
+// State of a slot in the ring
+enum image_state
+{
+    IMAGE_EMPTY,        // holds no (complete) image
+    IMAGE_DOWNLOADING,  // being refilled
+    IMAGE_READY,        // holds an image the host has not opened yet
+    IMAGE_SERVED,       // the host opened the image already
+};
+
+struct image_ring_stats
+{
+    uint32_t hits;      // host opened a ready slot
+    uint32_t misses;    // host opened a slot with an old, incomplete or no image
+    int32_t cursor;     // slot the host opened last, -1: none yet
+};
+
+// Host opened slot (read its first sector). Counts a hit or miss and moves the ring cursor
+void storage_ring_opened(uint32_t slot);
+// Next slot to download into, to keep STORAGE_IMG_PREFETCH slots ahead of the cursor ready. -1: ring is full
+int32_t storage_ring_next(void);
+// The image slot holds is still the newest (server said not modified): ready again, without a publish,
+// so the host sees no change. No effect on an empty slot
+void storage_ring_keep(uint32_t slot);
+enum image_state storage_ring_state(uint32_t slot);
+void storage_ring_stats(struct image_ring_stats *stats);
+
+void prepare_files(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,6 +1,16 @@
 #pragma once
-#include <FastLED.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "event_queue.h"
 
-extern CRGB leds[];  // defined in usb_msc.cpp, used for FastLED.addLeds in main.cpp
+// What the host does, posted by the USB callbacks, consumed by http_client_process() (single consumer)
+extern struct event_queue usb_events;
 
 void usb_msc_begin(void);
+// Ends a media change pulse, starts one when new images are published (frame profile). Call from loop()
+void usb_msc_process(void);
+// Frame profile, decides if and how the host is told about new images. false: no profile called name
+bool usb_msc_set_profile(const char *name);
+// Name of profile number i, NULL past the last one
+const char *usb_msc_profile_name(uint32_t i);
+void usb_msc_status(char *buf, size_t len);
@@ -0,0 +1,65 @@
+#pragma once
+// The virtual FAT16 volume the host sees
+// Add or resize files here, volume.cpp generates all filesystem structures from it
+#include "fat16.h"
+
+namespace volume
+{
+
+// Image files IMG1.JPG ... IMGn.JPG, one per image slot (STORAGE_IMG_SLOTS)
+constexpr const char * IMAGE_NAMES[] =
+{
+    "IMG1.JPG",  "IMG2.JPG",  "IMG3.JPG",  "IMG4.JPG",  "IMG5.JPG",  "IMG6.JPG",  "IMG7.JPG",  "IMG8.JPG",
+    "IMG9.JPG",  "IMG10.JPG", "IMG11.JPG", "IMG12.JPG", "IMG13.JPG", "IMG14.JPG", "IMG15.JPG", "IMG16.JPG",
+};
+static_assert(STORAGE_IMG_SLOTS >= 1 && STORAGE_IMG_SLOTS <= sizeof(IMAGE_NAMES) / sizeof(IMAGE_NAMES[0]),
+              "STORAGE_IMG_SLOTS out of range");
+
+enum { CREDS, FIRST_IMAGE, NUM_FILES = FIRST_IMAGE + STORAGE_IMG_SLOTS };
+constexpr int NUM_IMAGES = NUM_FILES - FIRST_IMAGE;
+
+constexpr std::array<fat16::file, NUM_FILES> make_files()
+{
+    std::array<fat16::file, NUM_FILES> f{};
+    f[CREDS] = { "CREDS.JSN", 4 * DISK_SECTOR_SIZE };                   // 2kB, credentials
+    for (int i = 0; i < NUM_IMAGES; i++)
+    {
+        f[FIRST_IMAGE + i] = { IMAGE_NAMES[i], fat16::div_up(STORAGE_IMG_FILE_SIZE, DISK_SECTOR_SIZE) * DISK_SECTOR_SIZE };
+    }
+    return f;
+}
+constexpr auto FILES = make_files();
+
+constexpr auto LAYOUT = fat16::make_layout(FILES);
+static_assert(fat16::is_valid(LAYOUT), "file list does not fit the FAT16 volume");
+
+constexpr uint32_t DISK_SECTORS = LAYOUT.p.disk_sectors;
+
+constexpr uint32_t file_lba(int i)     { return LAYOUT.map[i].lba; }
+constexpr uint32_t file_sectors(int i) { return LAYOUT.map[i].sectors; }
+
+// Image slot whose file starts at lba, -1 if none does (image files are back to back, all the same size)
+constexpr int image_at(uint32_t lba)
+{
+    const uint32_t first = file_lba(FIRST_IMAGE);
+    const uint32_t sectors = file_sectors(FIRST_IMAGE);
+    if ((lba < first) || ((lba - first) % sectors != 0) || ((lba - first) / sectors >= (uint32_t)NUM_IMAGES))
+    {
+        return -1;
+    }
+    return (int)((lba - first) / sectors);
+}
+
+// Image slot whose file holds lba, -1 if none does
+constexpr int image_holding(uint32_t lba)
+{
+    const uint32_t first = file_lba(FIRST_IMAGE);
+    const uint32_t sectors = file_sectors(FIRST_IMAGE);
+    if ((lba < first) || ((lba - first) / sectors >= (uint32_t)NUM_IMAGES))
+    {
+        return -1;
+    }
+    return (int)((lba - first) / sectors);
+}
+
+} // namespace volume
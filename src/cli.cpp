@@ -1,14 +1,50 @@
 #include "cli.h"
 #include "credentials.h"
+#include "storage.h"
+#include "http_client.h"
+#include "usb_msc.h"
+#include "lba_trace.h"
 #include <Arduino.h>
 #include <stdio.h>
 #include <string.h>
 
 extern void wifi_status(char *buf, size_t len);
+extern void loop_status(char *buf, size_t len);
 
 static char line_buf[256];
 static int  line_len = 0;
 
+// Latest entries of the LBA trace, with the file each one hits and the time since the one before
+static void print_trace(uint32_t max)
+{
+    static const char OP[] = { 'R', 'W' };
+    const uint32_t end = lba_trace_end();
+    uint32_t seq = (end > max) ? end - max : 0;
+    uint32_t t_prev = 0;
+    Serial.printf("LBA trace: %u recorded, %u kept, recording %s\r\n", end, LBA_TRACE_ENTRIES,
+                  lba_trace_enabled() ? "on" : "off");
+    Serial.print("     seq       t_us op     lba size  off  got      dt_us  file\r\n");
+    for (; seq != end; seq++)
+    {
+        struct lba_trace_entry e;
+        if (!lba_trace_get(seq, &e))
+        {
+            continue;
+        }
+        uint32_t sector;
+        const char *name = volume_lba_name(e.lba, &sector);
+        Serial.printf("%8u %10u  %c %7u %4u %4u %4u %10d  %s+%u\r\n", seq, e.t_us, OP[e.op & 1], e.lba, e.bufsize,
+                      e.offset, e.result, t_prev ? (int)(e.t_us - t_prev) : 0, name ? name : "-", sector);
+        t_prev = e.t_us;
+    }
+}
+
+static void print_line(const char *line, void *ctx)
+{
+    (void)ctx;
+    Serial.printf("%s\r\n", line);
+}
+
 static void dispatch(const char *line)
 {
     // set <key> <value>
@@ -18,7 +54,7 @@ static void dispatch(const char *line)
         const char *sp = strchr(rest, ' ');
         if (!sp)
         {
-            Serial.print("ERR: usage: set <ssid|password|url> <value>\r\n");
+            Serial.print("ERR: usage: set <ssid|password|url|profile|resolution|trace|fetch> <value>\r\n");
             return;
         }
 
@@ -49,6 +85,66 @@ static void dispatch(const char *line)
             creds_set_url(value);
             return;
         }
+        if (strcmp(key, "trace") == 0)
+        {
+            if (strcmp(value, "clear") == 0)
+            {
+                lba_trace_clear();
+            }
+            else if ((strcmp(value, "on") == 0) || (strcmp(value, "off") == 0))
+            {
+                lba_trace_enable(value[1] == 'n');
+            }
+            else
+            {
+                Serial.print("ERR: usage: set trace <on|off|clear>\r\n");
+            }
+            return;
+        }
+        if (strcmp(key, "fetch") == 0)
+        {
+            static const char * const CMD[] = { "now", "pause", "resume" };
+            for (uint32_t i = 0; i < sizeof(CMD) / sizeof(CMD[0]); i++)
+            {
+                if (strcmp(value, CMD[i]) == 0)
+                {
+                    if (!http_client_command((enum http_command)(HTTP_CMD_FETCH_NOW + i)))
+                    {
+                        Serial.print("ERR: fetch task busy\r\n");
+                    }
+                    return;
+                }
+            }
+            Serial.print("ERR: usage: set fetch <now|pause|resume>\r\n");
+            return;
+        }
+        if (strcmp(key, "resolution") == 0)
+        {
+            unsigned w, h;
+            char end;
+            if (sscanf(value, "%ux%u%c", &w, &h, &end) != 2 || w == 0 || h == 0)
+            {
+                Serial.print("ERR: usage: set resolution <width>x<height>, e.g. 1024x768\r\n");
+                return;
+            }
+            creds_set_resolution(value);
+            return;
+        }
+        if (strcmp(key, "profile") == 0)
+        {
+            if (!usb_msc_set_profile(value))
+            {
+                Serial.print("ERR: profile is one of:");
+                for (uint32_t i = 0; usb_msc_profile_name(i) != NULL; i++)
+                {
+                    Serial.printf(" %s", usb_msc_profile_name(i));
+                }
+                Serial.print("\r\n");
+                return;
+            }
+            creds_set_profile(value);
+            return;
+        }
         // Otherwise
         Serial.printf("ERR: unknown key \"%s\"\r\n", key);
         return;
@@ -67,7 +163,112 @@ static void dispatch(const char *line)
             return;
         }
 
+        if (strcmp(key, "mem") == 0)
+        {
+            Serial.printf("Image buffers: %u bytes (%u slots x %u, spare %u)\r\n",
+                          storage_image_mem(), STORAGE_IMG_SLOTS, STORAGE_IMG_SIZE, STORAGE_IMG_BACK_SIZE);
+            Serial.printf("Heap: %u bytes free, %u bytes min free, %u bytes largest block\r\n",
+                          ESP.getFreeHeap(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
+            return;
+        }
+
+        if (strcmp(key, "ring") == 0)
+        {
+            static const char * const STATE[] = { "empty", "downloading", "ready", "served" };
+            struct image_ring_stats st;
+            storage_ring_stats(&st);
+            Serial.printf("Ring: %u slots, prefetch %u, cursor %d\r\n", STORAGE_IMG_SLOTS, STORAGE_IMG_PREFETCH, (int)st.cursor);
+            for (uint32_t i = 0; i < STORAGE_IMG_SLOTS; i++)
+            {
+                const struct image_buf *front = storage_image_front(i);
+                Serial.printf("  IMG%u.JPG  %-11s %6u bytes %6u stored %s%s\r\n", i + 1, STATE[storage_ring_state(i)],
+                              front->len, front->stored, (front->size == 0) ? "flash" : "RAM  ", ((int32_t)i == st.cursor) ? "  <" : "");
+            }
+            const uint32_t opened = st.hits + st.misses;
+            Serial.printf("Hits: %u, misses: %u (%u%% hit)\r\n", st.hits, st.misses,
+                          opened ? (100 * st.hits / opened) : 0);
+            return;
+        }
+
+        if (strcmp(key, "cache") == 0)
+        {
+            char buf[192];
+            http_client_cache_status(buf, sizeof(buf));
+            Serial.printf("Cache: %s\r\n", buf);
+            return;
+        }
+
+        if (strcmp(key, "conn") == 0)
+        {
+            char buf[512];
+            http_client_conn_status(buf, sizeof(buf));
+            Serial.printf("Connection: %s\r\n", buf);
+            return;
+        }
+
+        if (strcmp(key, "etag") == 0)
+        {
+            char buf[256];
+            http_client_cond_status(buf, sizeof(buf));
+            Serial.printf("Conditional GET: %s\r\n", buf);
+            return;
+        }
+
+        if (strcmp(key, "sched") == 0)
+        {
+            char buf[320];
+            http_client_sched_status(buf, sizeof(buf));
+            Serial.printf("Schedule: %s\r\n", buf);
+            return;
+        }
+
+        if (strcmp(key, "loop") == 0)
+        {
+            char buf[160];
+            loop_status(buf, sizeof(buf));
+            Serial.printf("Loop: %s\r\n", buf);
+            http_client_task_status(buf, sizeof(buf));
+            Serial.printf("Fetch: %s\r\n", buf);
+            return;
+        }
+
+        if (strcmp(key, "trace") == 0)
+        {
+            print_trace(64);
+            return;
+        }
+        if (strcmp(key, "trace all") == 0)
+        {
+            print_trace(LBA_TRACE_ENTRIES);
+            return;
+        }
+        if (strcmp(key, "trace hex") == 0)
+        {
+            lba_trace_export(print_line, NULL);
+            return;
+        }
+
+        if (strcmp(key, "usb") == 0)
+        {
+            char buf[384];
+            usb_msc_status(buf, sizeof(buf));
+            Serial.printf("USB: %s\r\n", buf);
+            return;
+        }
+
         char value[256];
+        if (strcmp(key, "profile") == 0)
+        {
+            creds_get_profile(value, sizeof(value));
+            Serial.printf("%s = \"%s\"\r\n", key, value);
+            return;
+        }
+        if (strcmp(key, "resolution") == 0)
+        {
+            creds_get_resolution(value, sizeof(value));
+            Serial.printf("%s = \"%s\"\r\n", key, value);
+            return;
+        }
         if (strcmp(key, "ssid") == 0)
         {
             creds_get_ssid(value, sizeof(value));
@@ -91,13 +292,13 @@ static void dispatch(const char *line)
         return;
     }
 
-    Serial.print("ERR: unknown command.\r\nCommands:\r\n - set <ssid|password|url> <value>\r\n - get <ssid|password|url|wifi>\r\n");
+    Serial.print("ERR: unknown command.\r\nCommands:\r\n - set <ssid|password|url|profile|resolution|trace|fetch> <value>\r\n - get <ssid|password|url|profile|resolution|wifi|mem|ring|cache|conn|etag|sched|usb|loop|trace [all|hex]>\r\n");
 }
 
 void cli_begin(void)
 {
     creds_begin();
-    Serial.print("CLI ready.\r\nCommands:\r\n - set <ssid|password|url> <value>\r\n - get <ssid|password|url|wifi>\r\n");
+    Serial.print("CLI ready.\r\nCommands:\r\n - set <ssid|password|url|profile|resolution|trace|fetch> <value>\r\n - get <ssid|password|url|profile|resolution|wifi|mem|ring|cache|conn|etag|sched|usb|loop|trace [all|hex]>\r\n");
 }
 
 void cli_process(void)
@@ -0,0 +1,39 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "event_queue.h"
+
+
+bool event_queue_push(struct event_queue * q, const struct storage_event * ev)
+{
+    const uint32_t tail = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+    // Slots the consumer is done with: everything before head
+    if (tail - __atomic_load_n(&q->head, __ATOMIC_ACQUIRE) >= EVENT_QUEUE_SIZE)
+    {
+        __atomic_store_n(&q->dropped, q->dropped + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    q->ev[tail & (EVENT_QUEUE_SIZE - 1)] = *ev;
+    // Event first, then the tail that hands it over
+    __atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+bool event_queue_pop(struct event_queue * q, struct storage_event * ev)
+{
+    const uint32_t head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+    if (head == __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+    *ev = q->ev[head & (EVENT_QUEUE_SIZE - 1)];
+    // Copied out before the producer may reuse the slot
+    __atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+uint32_t event_queue_dropped(const struct event_queue * q)
+{
+    return __atomic_load_n(&q->dropped, __ATOMIC_RELAXED);
+}
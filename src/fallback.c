@@ -0,0 +1,79 @@
+#include <stdint.h>
+#include <string.h>
+#include "fallback.h"
+#include "storage.h"
+#include "lz4_block.h"
+
+extern const unsigned char FALLBACK_BUNDLE[];
+extern const unsigned int FALLBACK_BUNDLE_len;
+
+// Layout: see tools/mkbundle.py
+#define BUNDLE_MAGIC    0x314E4246u     // "FBN1"
+#define BUNDLE_RAW      0x80000000u     // index entry: block stored as is
+
+
+// Little endian word at offset of the bundle, 0 beyond its end
+static uint32_t bundle_word(uint32_t offset)
+{
+    if ((offset > FALLBACK_BUNDLE_len) || (FALLBACK_BUNDLE_len - offset < sizeof(uint32_t)))
+    {
+        return 0;
+    }
+    const unsigned char * p = &FALLBACK_BUNDLE[offset];
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+uint32_t fallback_count(void)
+{
+    if (bundle_word(0) != BUNDLE_MAGIC)
+    {
+        return 0;
+    }
+    const uint32_t count = bundle_word(4);
+    return (count <= (FALLBACK_BUNDLE_len - 8) / 8) ? count : 0;
+}
+
+
+uint32_t fallback_size(uint32_t image)
+{
+    return (image < fallback_count()) ? bundle_word(8 + 8 * image + 4) : 0;
+}
+
+
+uint32_t fallback_bundle_size(void)
+{
+    return FALLBACK_BUNDLE_len;
+}
+
+
+uint32_t fallback_read_block(uint32_t image, uint32_t block, void * out)
+{
+    const uint32_t len = fallback_size(image);
+    if (block >= (len + STORAGE_IMG_BLOCK - 1) / STORAGE_IMG_BLOCK)
+    {
+        return 0;
+    }
+    const uint32_t n = (len - block * STORAGE_IMG_BLOCK < STORAGE_IMG_BLOCK) ? (len - block * STORAGE_IMG_BLOCK) : STORAGE_IMG_BLOCK;
+
+    // Index of the image's blocks first, the blocks right behind it
+    const uint32_t index = bundle_word(8 + 8 * image);
+    const uint32_t data = index + sizeof(uint32_t) * ((len + STORAGE_IMG_BLOCK - 1) / STORAGE_IMG_BLOCK);
+    const uint32_t start = (block > 0) ? (bundle_word(index + sizeof(uint32_t) * (block - 1)) & ~BUNDLE_RAW) : 0;
+    const uint32_t end = bundle_word(index + sizeof(uint32_t) * block);
+    const uint32_t packed = (end & ~BUNDLE_RAW) - start;
+    if ((start > (end & ~BUNDLE_RAW)) || (data + (end & ~BUNDLE_RAW) > FALLBACK_BUNDLE_len) || (data < index))
+    {
+        return 0;
+    }
+    if (end & BUNDLE_RAW)
+    {
+        if (packed != n)
+        {
+            return 0;
+        }
+        memcpy(out, &FALLBACK_BUNDLE[data + start], n);
+        return n;
+    }
+    return (lz4_block_decompress(&FALLBACK_BUNDLE[data + start], packed, out, n) == n) ? n : 0;
+}
@@ -0,0 +1,572 @@
+// Fallback images, generated by tools/mkbundle.py - do not edit
+// 2 images (img1.jpg, img2.jpg)
+// 14724 bytes, packed to 9043 bytes
+const unsigned char FALLBACK_BUNDLE[] = {
+  0x46, 0x42, 0x4e, 0x31, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x12, 0x00, 0x00,
+  0x62, 0x0a, 0x00, 0x00, 0x6b, 0x27, 0x00, 0x00, 0x53, 0x09, 0x00, 0x00, 0x42, 0x0a, 0x00, 0x00,
+  0xff, 0x0b, 0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x02,
+  0x00, 0x98, 0x00, 0x91, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0xff, 0x01, 0x00, 0x2d, 0x4f,
+  0xdb, 0x00, 0x43, 0x01, 0x44, 0x00, 0x2d, 0xf8, 0x0e, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x02, 0x58,
+  0x03, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x17,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0xf6, 0x00, 0x02, 0x01, 0x03, 0xff, 0xc4, 0x00,
+  0x20, 0x10, 0x01, 0x01, 0x00, 0x03, 0x00, 0x02, 0x03, 0x1f, 0x00, 0xfd, 0x01, 0x01, 0x02, 0x11,
+  0x31, 0x41, 0x51, 0x21, 0x71, 0x81, 0x12, 0x61, 0x91, 0xff, 0xc4, 0x00, 0x16, 0x3a, 0x00, 0x30,
+  0x00, 0x01, 0x02, 0x53, 0x00, 0x1d, 0x11, 0x19, 0x00, 0xf8, 0x03, 0x01, 0x11, 0x41, 0xff, 0xda,
+  0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xe8, 0x71, 0x00, 0x0f,
+  0x0c, 0x00, 0xe2, 0xb6, 0xcb, 0x74, 0x05, 0xba, 0x27, 0x10, 0xb9, 0xc1, 0x35, 0xa0, 0x0a, 0x00,
+  0x01, 0xc6, 0x01, 0xc6, 0x5b, 0xa4, 0x5b, 0xb0, 0x5c, 0xbb, 0x6a, 0x71, 0xe2, 0x80, 0x16, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0x4c, 0xbb, 0xbf, 0xe2, 0x6d, 0xdf, 0xd1, 0x8f, 0x7f, 0x04, 0x74, 0x00,
+  0x50, 0x19, 0x00, 0x0f, 0x0c, 0x00, 0x09, 0xf4, 0x00, 0x01, 0x36, 0xfa, 0x06, 0xda, 0x80, 0x19,
+  0x17, 0x38, 0x85, 0xce, 0x0b, 0x1a, 0x00, 0xa0, 0x2b, 0x00, 0xf4, 0x02, 0x03, 0x2d, 0xd1, 0x6e,
+  0xbe, 0xdc, 0xc4, 0xd6, 0xf5, 0x80, 0x22, 0xf1, 0xe2, 0x93, 0x8f, 0x14, 0x34, 0x19, 0x00, 0xf5,
+  0x06, 0x00, 0x03, 0x2d, 0xd0, 0x16, 0xe9, 0xce, 0xdd, 0x96, 0xed, 0x82, 0x0a, 0xc7, 0xbf, 0x89,
+  0x56, 0x3d, 0xfc, 0x07, 0x40, 0x05, 0x1d, 0x00, 0x0f, 0x09, 0x00, 0x0b, 0xf4, 0x01, 0x01, 0x16,
+  0xec, 0x1b, 0x6a, 0x40, 0x64, 0x01, 0x01, 0x73, 0x88, 0x5c, 0xe2, 0xac, 0x68, 0x02, 0xbe, 0x00,
+  0xf4, 0x01, 0x9b, 0x7d, 0x17, 0x2f, 0x11, 0x02, 0x68, 0x00, 0x80, 0x00, 0xbc, 0x78, 0xa4, 0xe3,
+  0xc5, 0x0d, 0x46, 0x00, 0xf7, 0x06, 0x09, 0xb9, 0x6b, 0xec, 0x1b, 0x6e, 0xbe, 0xdc, 0xfa, 0x30,
+  0x40, 0x00, 0x15, 0x8f, 0x7f, 0x12, 0xac, 0x7b, 0xf8, 0x0e, 0x80, 0x09, 0x01, 0x04, 0x28, 0x00,
+  0x0f, 0x08, 0x00, 0x01, 0xf2, 0x05, 0xcb, 0x74, 0x9b, 0x76, 0x25, 0xa5, 0xbb, 0x60, 0x22, 0x00,
+  0x00, 0x00, 0x0b, 0x9c, 0x42, 0xe7, 0x15, 0x63, 0x40, 0x14, 0x28, 0x00, 0x80, 0x45, 0xbb, 0xe3,
+  0x2d, 0xdf, 0xd3, 0x04, 0xd0, 0xd0, 0x02, 0x63, 0x17, 0x8f, 0x14, 0x9c, 0x78, 0xa1, 0xf6, 0x00,
+  0xbf, 0x11, 0x72, 0xf1, 0x01, 0xb7, 0x2f, 0x11, 0xcc, 0x04, 0x00, 0x00, 0x6f, 0x00, 0x1c, 0x80,
+  0x32, 0xdd, 0x16, 0xe9, 0x02, 0x5a, 0x00, 0x88, 0x61, 0x00, 0x70, 0x02, 0xe7, 0x10, 0xb9, 0xc5,
+  0x58, 0xd0, 0x14, 0x01, 0xc0, 0x01, 0x96, 0xe8, 0x0b, 0x74, 0x8b, 0x76, 0x5b, 0xb6, 0x08, 0x00,
+  0x20, 0x1b, 0x00, 0x70, 0x2f, 0x1e, 0x29, 0x38, 0xf1, 0x43, 0x40, 0x0b, 0x00, 0x90, 0x07, 0x1c,
+  0xed, 0xdf, 0xd0, 0x17, 0x2d, 0xfd, 0x24, 0x6d, 0x00, 0xa6, 0x00, 0x01, 0x58, 0xf7, 0xf1, 0x2a,
+  0xc7, 0xbf, 0x80, 0xe8, 0x81, 0x01, 0x00, 0x25, 0x00, 0x0f, 0x04, 0x00, 0x03, 0x71, 0x26, 0xd2,
+  0xdf, 0x49, 0x12, 0xd0, 0x04, 0x47, 0x00, 0x16, 0x00, 0x4b, 0x01, 0xa2, 0x09, 0xb7, 0x5f, 0x60,
+  0xdb, 0x74, 0x86, 0x02, 0x00, 0x08, 0x37, 0x00, 0x05, 0x4b, 0x01, 0xa2, 0x0c, 0xb7, 0x45, 0xba,
+  0x73, 0xb7, 0x60, 0x5b, 0xb6, 0x00, 0x70, 0x01, 0xa2, 0x02, 0xb1, 0xef, 0xe2, 0x55, 0x8f, 0x7f,
+  0x01, 0xd0, 0x01, 0x43, 0x00, 0x02, 0x2f, 0x00, 0x0f, 0x06, 0x00, 0x02, 0x83, 0x04, 0xda, 0xcb,
+  0x76, 0xc1, 0x2d, 0x00, 0x44, 0x1d, 0x00, 0xf3, 0x01, 0x01, 0x73, 0x89, 0x93, 0x6b, 0x55, 0x80,
+  0x02, 0x80, 0x8b, 0x7d, 0x03, 0x6d, 0xf4, 0x80, 0x19, 0x17, 0x00, 0xf4, 0x06, 0x00, 0x1b, 0x26,
+  0xc1, 0x58, 0xf1, 0x4c, 0x93, 0x4d, 0x1a, 0x00, 0x01, 0x36, 0xeb, 0xec, 0xb9, 0x6b, 0xe2, 0x75,
+  0x02, 0x0c, 0x1c, 0x00, 0x00, 0xdb, 0x00, 0x5f, 0x8b, 0xc6, 0x6b, 0xec, 0x14, 0xdb, 0x00, 0x0d,
+  0xa0, 0x32, 0xdd, 0x03, 0x78, 0x8b, 0x76, 0x6f, 0x6c, 0x19, 0xb4, 0x99, 0x01, 0x01, 0x3f, 0x00,
+  0xf2, 0x02, 0x1b, 0x26, 0xdb, 0x22, 0x95, 0x64, 0x00, 0x14, 0x0e, 0x39, 0xdb, 0xb0, 0x6d, 0xbb,
+  0xfa, 0x48, 0x0c, 0xc1, 0x00, 0xf3, 0x06, 0x00, 0x00, 0x0d, 0x93, 0x60, 0x49, 0xb5, 0xc9, 0xa6,
+  0xf0, 0x1a, 0x00, 0x01, 0x17, 0x2f, 0x13, 0xfe, 0x97, 0x2d, 0xfc, 0x44, 0xf6, 0x00, 0xd3, 0x00,
+  0x00, 0x00, 0x37, 0xa4, 0x9b, 0x74, 0x93, 0x40, 0x49, 0xaf, 0xb6, 0x80, 0xd8, 0x01, 0x01, 0x4c,
+  0x00, 0x0f, 0x05, 0x00, 0x00, 0x75, 0x32, 0xdd, 0x01, 0x6e, 0x90, 0x03, 0x20, 0x3a, 0x00, 0xf4,
+  0x03, 0xa9, 0x3d, 0xb6, 0x46, 0xaa, 0xc8, 0x00, 0x28, 0xcb, 0x74, 0x5b, 0xa4, 0x5b, 0xb1, 0x0b,
+  0x76, 0xc0, 0x10, 0x35, 0x00, 0xf5, 0x02, 0x54, 0x9e, 0xc0, 0x93, 0x7f, 0x4b, 0x01, 0xa0, 0x19,
+  0x6e, 0x81, 0xae, 0x76, 0xef, 0xe8, 0xb7, 0x69, 0x1a, 0x00, 0xb0, 0x00, 0x6c, 0x9b, 0x6c, 0x9b,
+  0xfa, 0x74, 0xe0, 0x32, 0x4d, 0x34, 0xf2, 0x01, 0x04, 0x31, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x81,
+  0x01, 0x36, 0xfa, 0x02, 0xdf, 0x49, 0x01, 0x90, 0xf1, 0x01, 0xf4, 0x06, 0x00, 0x00, 0x00, 0x3a,
+  0x02, 0xe4, 0xd1, 0x26, 0x9a, 0xab, 0x20, 0x00, 0xa3, 0x2d, 0xd7, 0xdb, 0x2d, 0xf4, 0x81, 0x34,
+  0x00, 0x8f, 0x01, 0xf4, 0x03, 0x01, 0x72, 0x6b, 0xec, 0x52, 0x4f, 0x6a, 0x01, 0x40, 0x65, 0xba,
+  0x02, 0xdd, 0x39, 0xdb, 0xb2, 0xdd, 0xb0, 0x1a, 0x00, 0xaf, 0x00, 0x01, 0x53, 0x1d, 0xf7, 0x8d,
+  0x98, 0xf9, 0xab, 0x00, 0xbc, 0x01, 0x0d, 0x74, 0x45, 0xbb, 0x0d, 0x2d, 0xdb, 0x00, 0x64, 0x4b,
+  0x01, 0xf2, 0x03, 0x1b, 0x26, 0xc0, 0x93, 0x6a, 0x93, 0x4d, 0x15, 0x70, 0x00, 0x51, 0x37, 0x2f,
+  0x11, 0x96, 0xfa, 0x48, 0x9a, 0x92, 0x02, 0xf4, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x24, 0xda, 0xe4,
+  0xd0, 0xa4, 0x9a, 0x68, 0x0a, 0x02, 0x6e, 0x5e, 0x20, 0x17, 0x2d, 0x7d, 0xa1, 0x80, 0x66, 0x01,
+  0xcf, 0x03, 0x41, 0x8e, 0x93, 0x1f, 0x34, 0x98, 0xeb, 0xed, 0x40, 0x00, 0x28, 0xd1, 0x00, 0x00,
+  0x07, 0x13, 0x00, 0x00, 0x32, 0x01, 0x64, 0x74, 0x4b, 0x5b, 0x6e, 0xd8, 0x08, 0x3c, 0x00, 0xf6,
+  0x02, 0x02, 0xa4, 0xf6, 0xa3, 0x24, 0xda, 0xc0, 0x68, 0x02, 0xdd, 0x00, 0x8b, 0x77, 0xf4, 0xcb,
+  0x76, 0xc1, 0xdf, 0x00, 0x70, 0x1b, 0x26, 0xc9, 0x37, 0xf4, 0xe8, 0x2e, 0x32, 0x01, 0xa4, 0x01,
+  0xce, 0xe5, 0xbe, 0x70, 0x1b, 0x72, 0xf1, 0x10, 0x02, 0x4d, 0x00, 0x00, 0xda, 0x01, 0x64, 0xb7,
+  0x49, 0x34, 0x49, 0xa6, 0x8a, 0x12, 0x00, 0x0f, 0x08, 0x00, 0x04, 0x00, 0xa1, 0x04, 0x36, 0x90,
+  0x25, 0xa0, 0x71, 0x00, 0xf3, 0x00, 0xe4, 0xd2, 0x8c, 0x93, 0xda, 0x80, 0x68, 0x06, 0x5b, 0xa0,
+  0x2d, 0xd2, 0x2d, 0xd9, 0xd6, 0x73, 0x03, 0xf5, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x93, 0x64, 0x9e,
+  0x6a, 0xc5, 0xc0, 0x01, 0x43, 0x85, 0xf8, 0x72, 0xb7, 0x60, 0xdb, 0x77, 0xf4, 0x90, 0xbe, 0x01,
+  0x83, 0x54, 0x9b, 0xfa, 0x02, 0x4d, 0xae, 0x4d, 0x34, 0x1a, 0x04, 0x0f, 0x6b, 0x00, 0x04, 0xb3,
+  0x00, 0x00, 0x00, 0x01, 0x39, 0x75, 0x2a, 0xcb, 0xa9, 0x19, 0xa0, 0x2c, 0x02, 0xf3, 0x04, 0x03,
+  0x64, 0xda, 0xa4, 0xd2, 0x98, 0x49, 0xa6, 0x80, 0xd0, 0x00, 0x09, 0xcb, 0x8a, 0x4e, 0x5c, 0x04,
+  0x00, 0x32, 0x3c, 0x00, 0xf4, 0x03, 0x02, 0xe4, 0xf6, 0xd9, 0x35, 0xf6, 0xd1, 0x70, 0x00, 0x50,
+  0x00, 0x65, 0xe5, 0x72, 0x75, 0xbc, 0xae, 0x42, 0x8a, 0x05, 0xaf, 0x01, 0x73, 0x1f, 0x37, 0xfe,
+  0x01, 0x31, 0xdf, 0xcd, 0x58, 0xc2, 0x04, 0x10, 0x72, 0x09, 0xcb, 0xa9, 0x56, 0x5d, 0x48, 0xcd,
+  0x13, 0x02, 0x71, 0x06, 0xc9, 0xb2, 0x4d, 0xad, 0x56, 0x43, 0xfa, 0x04, 0x81, 0x27, 0x2e, 0x29,
+  0x39, 0x70, 0x10, 0x00, 0xc8, 0x6f, 0x00, 0x81, 0xd9, 0x36, 0x07, 0x57, 0x26, 0x89, 0x34, 0xd1,
+  0x81, 0x05, 0x09, 0x6f, 0x00, 0xaf, 0x01, 0xa2, 0xe4, 0xd7, 0xd8, 0x13, 0x1d, 0x7c, 0xde, 0xa8,
+  0x96, 0x02, 0x0c, 0x01, 0x48, 0x00, 0x80, 0x00, 0x4e, 0x5d, 0x4a, 0xb2, 0xea, 0x46, 0x68, 0x86,
+  0x01, 0x71, 0x02, 0xa4, 0x24, 0xf6, 0xa5, 0x59, 0x00, 0x37, 0x00, 0x80, 0x01, 0x39, 0x71, 0x49,
+  0xcb, 0x80, 0x80, 0x06, 0x7f, 0x02, 0x92, 0x54, 0x9b, 0xfa, 0x06, 0x49, 0xb7, 0x4d, 0x68, 0x06,
+  0xe2, 0x01, 0x80, 0x19, 0x79, 0x5c, 0x9d, 0x6f, 0x2b, 0x90, 0x94, 0x40, 0x00, 0x00, 0xa0, 0x00,
+  0x64, 0xba, 0x49, 0xa0, 0x24, 0xd3, 0x40, 0xec, 0x00, 0x00, 0x16, 0x00, 0x0f, 0x04, 0x00, 0x07,
+  0x06, 0x6e, 0x00, 0x40, 0x2a, 0x46, 0xc9, 0xa6, 0x72, 0x03, 0x02, 0x2c, 0x00, 0xf4, 0x02, 0x9c,
+  0xb8, 0xa4, 0xe5, 0xc0, 0x40, 0x03, 0x20, 0x00, 0x02, 0xe6, 0x3e, 0x68, 0x32, 0x4f, 0x6b, 0x01,
+  0xc0, 0x03, 0x06, 0xdb, 0x00, 0x9f, 0x01, 0x52, 0x6f, 0xe8, 0x98, 0xef, 0xe9, 0xd0, 0x0e, 0x92,
+  0x02, 0x0d, 0x02, 0x52, 0x00, 0xf5, 0x05, 0x00, 0x00, 0x02, 0x72, 0xea, 0x55, 0x97, 0x52, 0x33,
+  0x40, 0x6c, 0x9b, 0x41, 0x8b, 0x93, 0x44, 0x9a, 0x6a, 0xac, 0x80, 0x76, 0x06, 0x04, 0x6f, 0x00,
+  0x85, 0x3a, 0x49, 0xaf, 0xb1, 0x59, 0x26, 0xba, 0xa0, 0x05, 0x02, 0xff, 0x02, 0x01, 0x97, 0x95,
+  0xc9, 0xd6, 0xf2, 0xb9, 0x09, 0x40, 0x00, 0x5c, 0xc7, 0xcd, 0x26, 0x3e, 0x6a, 0xc0, 0x4e, 0x07,
+  0x17, 0x00, 0xdb, 0x00, 0x82, 0xeb, 0x24, 0xd8, 0xcf, 0x49, 0x36, 0xb0, 0x17, 0x44, 0x01, 0x01,
+  0x89, 0x00, 0x80, 0x13, 0x97, 0x14, 0x9c, 0xb8, 0x08, 0x6c, 0x9b, 0x6b, 0x03, 0x37, 0x84, 0x9a,
+  0x68, 0x01, 0x02, 0xf7, 0x01, 0x0c, 0xbc, 0xae, 0x4e, 0xb7, 0x95, 0xcf, 0xa2, 0x51, 0x73, 0x1d,
+  0x7d, 0xb6, 0x4d, 0x7d, 0xb4, 0x35, 0x00, 0x01, 0x3a, 0x00, 0x0f, 0x05, 0x00, 0x09, 0x39, 0x66,
+  0xb7, 0x5a, 0x1f, 0x00, 0x42, 0x32, 0xcd, 0xb4, 0x03, 0x9e, 0x01, 0x03, 0x17, 0x00, 0x50, 0x03,
+  0x2f, 0xcc, 0x24, 0xd3, 0xbd, 0x01, 0x03, 0x10, 0x00, 0x0f, 0x07, 0x00, 0xb2, 0xd4, 0x01, 0x96,
+  0xe8, 0x1a, 0x23, 0xfa, 0xa7, 0xf4, 0x26, 0xac, 0x64, 0xbb, 0x68, 0x22, 0x02, 0x01, 0xda, 0x00,
+  0xf9, 0x00, 0x32, 0xfc, 0x40, 0x68, 0x8f, 0xea, 0x9f, 0xd5, 0x13, 0x56, 0x23, 0xfa, 0xaa, 0x9c,
+  0x15, 0x1c, 0x00, 0x01, 0x21, 0x00, 0x0f, 0x05, 0x00, 0x11, 0xf6, 0x00, 0x0e, 0x77, 0xb5, 0xd1,
+  0xce, 0xf4, 0x4a, 0xc0, 0x04, 0x56, 0x3d, 0x5a, 0x31, 0xea, 0xc5, 0x2f, 0x02, 0xf2, 0x02, 0x00,
+  0x00, 0x00, 0xcb, 0xca, 0xd6, 0x5e, 0x50, 0x73, 0x00, 0x64, 0x74, 0x9c, 0x8e, 0x6e, 0x93, 0x90,
+  0xe4, 0x07, 0x0f, 0x54, 0x00, 0x11, 0xb0, 0x00, 0x00, 0x66, 0xe7, 0xb3, 0x73, 0xd8, 0x34, 0x66,
+  0xe7, 0xb6, 0xa0, 0x01, 0x80, 0x33, 0x73, 0xd9, 0xb9, 0xec, 0x1a, 0x33, 0x71, 0xa1, 0x00, 0xa4,
+  0x32, 0xcd, 0xb4, 0x04, 0xff, 0x00, 0x3f, 0xe9, 0xfc, 0xa8, 0x49, 0x00, 0xff, 0x0e, 0x06, 0x6e,
+  0x7b, 0x37, 0x3d, 0x83, 0x46, 0x6e, 0x7b, 0x68, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0xad, 0x65, 0xe5,
+  0x07, 0x30, 0x06, 0x47, 0x49, 0xc8, 0xe6, 0xe9, 0x39, 0x05, 0x8d, 0x8a, 0x02, 0x12, 0xf1, 0x29,
+  0x04, 0xe5, 0xe1, 0x0b, 0xcb, 0xc2, 0x04, 0xa3, 0xa6, 0x3c, 0x73, 0x6c, 0xba, 0x05, 0x5b, 0xa4,
+  0xee, 0xd6, 0x00, 0x00, 0x20, 0xdd, 0xd8, 0xc0, 0x17, 0x2e, 0xd4, 0xe4, 0xab, 0x76, 0x2e, 0x97,
+  0x2f, 0x49, 0x01, 0x00, 0x00, 0x6c, 0xb6, 0x30, 0x07, 0x49, 0x76, 0xd7, 0x39, 0x75, 0x5d, 0x06,
+  0x80, 0x00, 0x73, 0xbd, 0xae, 0x8e, 0x77, 0xb4, 0xf5, 0x00, 0xf5, 0x6c, 0xfc, 0x5a, 0x31, 0xef,
+  0xe2, 0xc5, 0x80, 0x02, 0xa7, 0x2f, 0x08, 0x5e, 0x5e, 0x10, 0x25, 0x1d, 0x27, 0x1c, 0xdb, 0x2e,
+  0x81, 0x56, 0xe9, 0x3b, 0xb5, 0x80, 0x00, 0x08, 0x37, 0x7a, 0x60, 0x0b, 0x99, 0x7b, 0x53, 0x92,
+  0xf1, 0xbb, 0x16, 0x28, 0x01, 0x46, 0x5e, 0x56, 0xb2, 0xf2, 0x83, 0x98, 0x03, 0x23, 0xa4, 0xe4,
+  0x73, 0x74, 0x9c, 0x82, 0xc6, 0x80, 0x28, 0xe4, 0xea, 0xe4, 0x25, 0x00, 0x11, 0x78, 0xf3, 0xf5,
+  0x49, 0xc7, 0x9f, 0xaa, 0x1a, 0x00, 0x01, 0xc9, 0xd5, 0xc8, 0x4a, 0x00, 0x22, 0xf1, 0xf2, 0xa4,
+  0xe3, 0xe5, 0x43, 0x50, 0x73, 0xb3, 0x4e, 0x8c, 0xb3, 0x60, 0xe6, 0x00, 0xc8, 0xe9, 0x2e, 0xdc,
+  0xd5, 0x2e, 0x85, 0x8b, 0x00, 0x51, 0xce, 0xdd, 0xd5, 0x65, 0x7c, 0x20, 0x4a, 0x00, 0x23, 0x7a,
+  0xb9, 0x34, 0xcc, 0x66, 0x94, 0x2c, 0x00, 0x81, 0x03, 0x01, 0x0b, 0x01, 0xf0, 0x2b, 0x13, 0x97,
+  0x84, 0x2f, 0x2f, 0x08, 0x12, 0x80, 0x08, 0x2f, 0xf9, 0xf6, 0x63, 0x3c, 0xa8, 0x5c, 0x4f, 0xf3,
+  0x19, 0x66, 0x96, 0x0b, 0x8e, 0x43, 0x6f, 0x58, 0x32, 0x00, 0x0d, 0x93, 0x6a, 0xfe, 0x5b, 0x26,
+  0xa3, 0x45, 0xc4, 0xff, 0x00, 0x31, 0x36, 0x69, 0xd1, 0x97, 0xe6, 0x06, 0x39, 0x80, 0x20, 0xe9,
+  0x38, 0xe6, 0xbc, 0x78, 0x2c, 0x50, 0x02, 0x8e, 0xc2, 0x01, 0xf2, 0x00, 0xf6, 0x89, 0x58, 0x00,
+  0x8a, 0xc7, 0xbf, 0x8b, 0x46, 0x3d, 0xfc, 0x58, 0xb0, 0x00, 0x54, 0x12, 0x01, 0xfc, 0x59, 0xa0,
+  0x02, 0x0b, 0xfe, 0x7d, 0x98, 0xcf, 0x2a, 0x17, 0x13, 0xfc, 0xc6, 0x5c, 0x7d, 0x2c, 0x15, 0xc8,
+  0x56, 0x53, 0xe5, 0x23, 0x23, 0x67, 0x58, 0xd0, 0x74, 0x00, 0x68, 0x65, 0xe5, 0x6b, 0x2f, 0x28,
+  0x39, 0x80, 0x32, 0x3a, 0x4e, 0x47, 0x37, 0x49, 0xc8, 0x2c, 0x68, 0x02, 0x8e, 0x4e, 0xae, 0x42,
+  0x50, 0x01, 0x17, 0x8f, 0x3f, 0x54, 0x9c, 0x79, 0xfa, 0xa1, 0xa0, 0x00, 0x1c, 0x9d, 0x5c, 0x84,
+  0xa0, 0x02, 0x2f, 0x1f, 0x2a, 0x4e, 0x3e, 0x54, 0x35, 0x00, 0x01, 0x39, 0x4f, 0x28, 0x75, 0x45,
+  0x9a, 0x12, 0xa4, 0x01, 0x17, 0x8d, 0xdb, 0x6d, 0xd2, 0x27, 0xc1, 0x6e, 0xc5, 0xd6, 0x00, 0x20,
+  0xac, 0x67, 0x96, 0x49, 0xb7, 0x41, 0x60, 0xeb, 0x08, 0xff, 0x19, 0x09, 0xcb, 0xc2, 0x17, 0x97,
+  0x84, 0x09, 0x40, 0x04, 0x75, 0x9c, 0x00, 0x68, 0x00, 0x1c, 0xf2, 0xeb, 0x15, 0x97, 0x52, 0x32,
+  0x36, 0x76, 0x31, 0x58, 0xf4, 0x16, 0x00, 0xd0, 0x00, 0x39, 0x00, 0x32, 0x2f, 0x14, 0x2f, 0x11,
+  0x62, 0x80, 0x14, 0x87, 0x01, 0x07, 0xff, 0x03, 0x01, 0xb0, 0x47, 0x40, 0x06, 0x80, 0x01, 0x39,
+  0x78, 0x42, 0xf2, 0x40, 0x94, 0x00, 0x47, 0x50, 0x06, 0x86, 0x7e, 0x01, 0x1b, 0xf1, 0x06, 0x00,
+  0x02, 0xfc, 0x80, 0x39, 0xdf, 0x86, 0x2f, 0x29, 0xf0, 0x81, 0x00, 0x04, 0x01, 0x58, 0xcf, 0x20,
+  0xa9, 0x34, 0xd0, 0x1a, 0x67, 0x01, 0x07, 0x05, 0x00, 0x03, 0x38, 0x02, 0x71, 0xa0, 0x02, 0x3a,
+  0x80, 0x34, 0x00, 0x08, 0x82, 0x06, 0xf2, 0x18, 0x82, 0xb1, 0xea, 0x55, 0x8f, 0x41, 0x60, 0x0a,
+  0x00, 0x0e, 0x40, 0x0c, 0x8b, 0xc5, 0x0b, 0xc4, 0x58, 0xa0, 0x05, 0x1c, 0xef, 0x6b, 0xa3, 0x9d,
+  0xed, 0x12, 0xb0, 0x01, 0x15, 0x8f, 0x7f, 0x16, 0x8c, 0x7b, 0xf8, 0xb1, 0x60, 0x00, 0xa9, 0xe0,
+  0x00, 0xf0, 0x01, 0x46, 0xce, 0xcf, 0xb6, 0x36, 0x76, 0x7d, 0x88, 0xe8, 0x00, 0xd0, 0x00, 0x27,
+  0x24, 0x2f, 0x24, 0xf1, 0x00, 0x0f, 0x59, 0x01, 0x0b, 0x00, 0x7b, 0x0b, 0xf6, 0x13, 0x1c, 0x9d,
+  0x2f, 0x2b, 0x98, 0x94, 0x00, 0x45, 0xe3, 0xe5, 0x49, 0xc7, 0xca, 0x86, 0xa0, 0x00, 0x00, 0x9c,
+  0xae, 0x81, 0x99, 0x5d, 0xa4, 0x06, 0x40, 0x00, 0x6c, 0xba, 0x60, 0x0e, 0xa2, 0x31, 0xbe, 0x16,
+  0x7c, 0x0c, 0x03, 0xad, 0x00, 0x06, 0x50, 0x01, 0xf2, 0x21, 0x00, 0x68, 0x00, 0x11, 0x97, 0x52,
+  0xac, 0xba, 0x91, 0x05, 0x63, 0xd4, 0xab, 0x1e, 0x82, 0xc0, 0x14, 0x00, 0x1c, 0x80, 0x19, 0x17,
+  0x8a, 0x17, 0x88, 0xb1, 0x40, 0x0a, 0x39, 0xde, 0xd7, 0x47, 0x3b, 0xda, 0x25, 0x60, 0x02, 0x2b,
+  0x1e, 0xfe, 0x2d, 0x18, 0xf7, 0xf1, 0x62, 0xc0, 0x01, 0x53, 0x54, 0x02, 0xfd, 0x07, 0x8d, 0x9d,
+  0x9f, 0x6c, 0x6c, 0xec, 0xfb, 0x11, 0xd0, 0x01, 0xa0, 0x00, 0x4e, 0x48, 0x5e, 0x48, 0x12, 0x80,
+  0x08, 0xea, 0x00, 0xd0, 0xde, 0x03, 0xfa, 0x34, 0x1c, 0x9d, 0x5c, 0xef, 0x44, 0xac, 0x00, 0x45,
+  0x63, 0x75, 0x56, 0xe4, 0xd9, 0x6c, 0x15, 0xd0, 0x47, 0xf5, 0x59, 0x6d, 0xa1, 0xad, 0xca, 0xf8,
+  0x48, 0x08, 0x00, 0x0b, 0xc7, 0xca, 0x93, 0x8f, 0x95, 0x0d, 0x40, 0x00, 0x65, 0xba, 0x41, 0x6e,
+  0xd8, 0x25, 0x01, 0xb3, 0xe4, 0x46, 0xe3, 0x3c, 0xb7, 0x29, 0xe5, 0x5c, 0x06, 0x9c, 0x86, 0xd9,
+  0xa6, 0x0c, 0x8e, 0x92, 0xed, 0xcd, 0xb2, 0xe8, 0x57, 0x40, 0xe8, 0x38, 0x09, 0x50, 0x00, 0x02,
+  0x72, 0xf0, 0x85, 0xf1, 0x6b, 0xe5, 0x36, 0x9d, 0x5f, 0x42, 0x56, 0x0d, 0xd5, 0xf4, 0x6a, 0xfa,
+  0x11, 0xd0, 0x01, 0xa0, 0x00, 0x46, 0x5d, 0x4a, 0xac, 0xbb, 0x66, 0xaf, 0xa1, 0x18, 0xac, 0x7a,
+  0xcd, 0x5f, 0x4d, 0x92, 0xec, 0x16, 0x00, 0xa0, 0x00, 0xe4, 0x37, 0x57, 0xd1, 0xab, 0xe8, 0x65,
+  0x8b, 0xc5, 0x3a, 0xbe, 0x95, 0x8c, 0xd0, 0xb1, 0x40, 0x0a, 0x39, 0xde, 0xd7, 0x44, 0x59, 0x76,
+  0x25, 0x48, 0xdd, 0x5f, 0x46, 0xaf, 0xa1, 0x1b, 0x8f, 0x7f, 0x16, 0x9c, 0x65, 0x95, 0x43, 0x50,
+  0x00, 0x13, 0x97, 0x84, 0x2f, 0x29, 0xbd, 0x27, 0x57, 0xd0, 0x95, 0x8d, 0x9d, 0x9f, 0x66, 0xaf,
+  0xa6, 0xc9, 0x77, 0xc0, 0x58, 0x02, 0x80, 0x02, 0x72, 0x42, 0xf2, 0x9b, 0x4e, 0xaf, 0xa1, 0x2b,
+  0x06, 0xea, 0xfa, 0x35, 0x7d, 0x08, 0xe8, 0x00, 0xd0, 0xcb, 0xca, 0xd6, 0x5e, 0x03, 0x98, 0x3d,
+  0x00, 0xf2, 0x19, 0x96, 0x3a, 0x4e, 0x44, 0x6a, 0xfa, 0x5c, 0xe4, 0x16, 0x34, 0x01, 0x46, 0x59,
+  0xb6, 0x80, 0xe4, 0x3a, 0x59, 0x2a, 0x7f, 0x9a, 0x26, 0x24, 0x6b, 0x04, 0x06, 0xea, 0xb6, 0x63,
+  0x41, 0x93, 0xe5, 0xb6, 0x6b, 0x4a, 0x93, 0x45, 0x9b, 0x82, 0xe3, 0x2e, 0x00, 0xff, 0x2a, 0x15,
+  0x8f, 0x95, 0x27, 0x19, 0xa5, 0x0d, 0x09, 0xca, 0xf8, 0x55, 0x73, 0xd5, 0x12, 0xb0, 0x6e, 0xaf,
+  0xa3, 0x57, 0xd0, 0x8c, 0x5e, 0x33, 0x4c, 0x93, 0xe7, 0xe5, 0x62, 0xc0, 0x01, 0x59, 0x66, 0xdc,
+  0xdd, 0x53, 0x94, 0xdf, 0x04, 0xa8, 0x1b, 0xab, 0xe8, 0xd5, 0xf4, 0x23, 0x65, 0xd2, 0xdc, 0xf5,
+  0x7d, 0x2e, 0x6f, 0xc8, 0xb1, 0xa0, 0x0a, 0x00, 0x01, 0x00, 0xff, 0x1c, 0x50, 0x00, 0x00, 0x00,
+  0xff, 0xd9, 0x18, 0x06, 0x00, 0x00, 0x7b, 0x11, 0x00, 0x00, 0xe5, 0x18, 0x00, 0x00, 0xf1, 0x20,
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x01, 0x2c,
+  0x01, 0x2c, 0x00, 0x00, 0xff, 0xe1, 0x00, 0xae, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x49, 0x49,
+  0x2a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x04,
+  0x00, 0x31, 0x1a, 0x01, 0x05, 0x08, 0x00, 0x53, 0x62, 0x00, 0x00, 0x00, 0x1b, 0x0c, 0x00, 0x53,
+  0x6a, 0x00, 0x00, 0x00, 0x28, 0x24, 0x00, 0xf1, 0x10, 0x02, 0x00, 0x00, 0x00, 0x31, 0x01, 0x02,
+  0x00, 0x0d, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x32, 0x01, 0x02, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x69, 0x87, 0x04, 0x3c, 0x00, 0x22, 0x94, 0x00, 0x01, 0x00, 0x22,
+  0x2c, 0x01, 0x54, 0x00, 0x04, 0x08, 0x00, 0xf6, 0x17, 0x47, 0x49, 0x4d, 0x50, 0x20, 0x32, 0x2e,
+  0x31, 0x30, 0x2e, 0x33, 0x36, 0x00, 0x00, 0x32, 0x30, 0x32, 0x36, 0x3a, 0x30, 0x32, 0x3a, 0x32,
+  0x30, 0x20, 0x30, 0x37, 0x3a, 0x34, 0x30, 0x3a, 0x30, 0x34, 0x00, 0x01, 0x00, 0x01, 0xa0, 0x8c,
+  0x00, 0x00, 0x46, 0x00, 0xf1, 0x5c, 0xff, 0xe1, 0x0c, 0xcf, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
+  0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
+  0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x00, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22, 0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d,
+  0x22, 0x57, 0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43, 0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53,
+  0x7a, 0x4e, 0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39, 0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a,
+  0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d,
+  0x22, 0x5d, 0x00, 0x40, 0x3a, 0x6e, 0x73, 0x3a, 0x17, 0x00, 0x31, 0x2f, 0x22, 0x20, 0x23, 0x00,
+  0xf3, 0x14, 0x74, 0x6b, 0x3d, 0x22, 0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x34,
+  0x2e, 0x34, 0x2e, 0x30, 0x2d, 0x45, 0x78, 0x69, 0x76, 0x32, 0x22, 0x3e, 0x20, 0x3c, 0x72, 0x64,
+  0x66, 0x3a, 0x52, 0x44, 0x46, 0x42, 0x00, 0x53, 0x72, 0x64, 0x66, 0x3d, 0x22, 0xab, 0x00, 0xf4,
+  0x15, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39,
+  0x2f, 0x30, 0x32, 0x2f, 0x32, 0x32, 0x2d, 0x72, 0x64, 0x66, 0x2d, 0x73, 0x79, 0x6e, 0x74, 0x61,
+  0x78, 0x2d, 0x6e, 0x73, 0x23, 0x42, 0x00, 0xc0, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x52, 0x00, 0x83, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x22, 0x22, 0x57,
+  0x00, 0x55, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x59, 0x00, 0x0f, 0x04, 0x01, 0x02, 0x20, 0x6d, 0x6d,
+  0xae, 0x00, 0x01, 0xc7, 0x00, 0x5f, 0x73, 0x74, 0x45, 0x76, 0x74, 0x2e, 0x00, 0x0b, 0xf4, 0x05,
+  0x73, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x45, 0x76,
+  0x65, 0x6e, 0x74, 0x23, 0x6d, 0x00, 0x25, 0x64, 0x63, 0x3c, 0x00, 0x41, 0x70, 0x75, 0x72, 0x6c,
+  0xc1, 0x00, 0xf5, 0x00, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2f,
+  0x31, 0x2e, 0x31, 0x6b, 0x00, 0x00, 0xce, 0x01, 0x05, 0x2e, 0x00, 0x00, 0xf1, 0x00, 0x41, 0x67,
+  0x69, 0x6d, 0x70, 0x32, 0x00, 0x35, 0x78, 0x6d, 0x70, 0x26, 0x00, 0x35, 0x78, 0x6d, 0x70, 0x25,
+  0x00, 0x0f, 0xbd, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x80, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x6f, 0x63,
+  0x75, 0x65, 0x00, 0x40, 0x49, 0x44, 0x3d, 0x22, 0x4a, 0x00, 0x71, 0x3a, 0x64, 0x6f, 0x63, 0x69,
+  0x64, 0x3a, 0x0b, 0x00, 0xf4, 0x15, 0x66, 0x64, 0x32, 0x33, 0x66, 0x37, 0x39, 0x35, 0x2d, 0x38,
+  0x63, 0x38, 0x39, 0x2d, 0x34, 0x65, 0x66, 0x31, 0x2d, 0x38, 0x31, 0x63, 0x34, 0x2d, 0x35, 0x31,
+  0x38, 0x39, 0x39, 0x32, 0x64, 0x38, 0x31, 0x66, 0x35, 0x38, 0x48, 0x00, 0x80, 0x49, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x63, 0x65, 0x48, 0x00, 0xf4, 0x1d, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64,
+  0x3a, 0x37, 0x36, 0x35, 0x38, 0x37, 0x32, 0x64, 0x33, 0x2d, 0x34, 0x63, 0x61, 0x36, 0x2d, 0x34,
+  0x62, 0x39, 0x39, 0x2d, 0x62, 0x38, 0x30, 0x35, 0x2d, 0x37, 0x31, 0x39, 0x65, 0x39, 0x31, 0x61,
+  0x35, 0x39, 0x34, 0x37, 0x66, 0x40, 0x00, 0x88, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c,
+  0x90, 0x00, 0x00, 0x48, 0x00, 0xf0, 0x32, 0x64, 0x69, 0x64, 0x3a, 0x66, 0x38, 0x34, 0x38, 0x65,
+  0x64, 0x36, 0x39, 0x2d, 0x37, 0x34, 0x38, 0x62, 0x2d, 0x34, 0x32, 0x64, 0x36, 0x2d, 0x38, 0x30,
+  0x38, 0x62, 0x2d, 0x62, 0x62, 0x66, 0x33, 0x39, 0x35, 0x38, 0x38, 0x37, 0x39, 0x63, 0x38, 0x22,
+  0x20, 0x64, 0x63, 0x3a, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67,
+  0x65, 0x2f, 0x6a, 0x70, 0x65, 0x67, 0x22, 0x20, 0x30, 0x01, 0x93, 0x3a, 0x41, 0x50, 0x49, 0x3d,
+  0x22, 0x32, 0x2e, 0x30, 0x0f, 0x00, 0xf3, 0x00, 0x50, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d,
+  0x3d, 0x22, 0x4c, 0x69, 0x6e, 0x75, 0x78, 0x16, 0x00, 0x70, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x74,
+  0x61, 0x3a, 0x01, 0xf3, 0x01, 0x31, 0x37, 0x37, 0x31, 0x35, 0x36, 0x39, 0x36, 0x30, 0x39, 0x36,
+  0x38, 0x39, 0x31, 0x32, 0x36, 0x22, 0x00, 0x70, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x4b,
+  0x00, 0x01, 0x4e, 0x03, 0x01, 0xbd, 0x00, 0xe0, 0x3a, 0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72,
+  0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x6f, 0x00, 0x01, 0x6d, 0x03, 0x02, 0x1c, 0x00, 0xe6, 0x4d,
+  0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x7c, 0x03, 0x14,
+  0x54, 0x7c, 0x03, 0x63, 0x2b, 0x30, 0x31, 0x3a, 0x30, 0x30, 0x2d, 0x00, 0x5f, 0x6f, 0x64, 0x69,
+  0x66, 0x79, 0x2b, 0x00, 0x0d, 0x00, 0x46, 0x03, 0x00, 0x9d, 0x02, 0x83, 0x3a, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x12, 0x03, 0x33, 0x53, 0x65, 0x71, 0x0a, 0x00, 0x31, 0x6c, 0x69, 0x20,
+  0x90, 0x02, 0x30, 0x3a, 0x61, 0x63, 0xde, 0x02, 0x83, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x64,
+  0x22, 0x15, 0x00, 0xa4, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x12, 0x00,
+  0x1f, 0x69, 0xbb, 0x01, 0x00, 0xf4, 0x15, 0x33, 0x37, 0x35, 0x35, 0x31, 0x38, 0x65, 0x37, 0x2d,
+  0x32, 0x65, 0x63, 0x32, 0x2d, 0x34, 0x66, 0x64, 0x30, 0x2d, 0x61, 0x31, 0x31, 0x37, 0x2d, 0x63,
+  0x61, 0x32, 0x66, 0x32, 0x65, 0x31, 0x33, 0x31, 0x65, 0x66, 0x62, 0x40, 0x00, 0xf1, 0x04, 0x73,
+  0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x47, 0x69,
+  0x6d, 0x70, 0x02, 0x01, 0x21, 0x20, 0x28, 0x5e, 0x01, 0x14, 0x29, 0x28, 0x00, 0x30, 0x77, 0x68,
+  0x65, 0x3b, 0x01, 0x94, 0x30, 0x32, 0x36, 0x2d, 0x30, 0x32, 0x2d, 0x32, 0x30, 0x04, 0x01, 0x13,
+  0x39, 0x04, 0x01, 0x50, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x8b, 0x03, 0x02, 0xcb, 0x00, 0x11, 0x2f,
+  0x83, 0x03, 0x07, 0xe6, 0x00, 0x01, 0x1c, 0x00, 0x07, 0xb7, 0x03, 0x04, 0x2f, 0x00, 0x30, 0x52,
+  0x44, 0x46, 0x0b, 0x00, 0x01, 0x38, 0x04, 0x00, 0x44, 0x04, 0x2f, 0x3e, 0x20, 0x01, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x06, 0x9d, 0x0c, 0xf0, 0x27, 0x65, 0x6e, 0x64, 0x3d,
+  0x22, 0x77, 0x22, 0x3f, 0x3e, 0xff, 0xe2, 0x02, 0xb0, 0x49, 0x43, 0x43, 0x5f, 0x50, 0x52, 0x4f,
+  0x46, 0x49, 0x4c, 0x45, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0xa0, 0x6c, 0x63, 0x6d, 0x73, 0x04,
+  0x40, 0x00, 0x00, 0x6d, 0x6e, 0x74, 0x72, 0x52, 0x47, 0x42, 0x20, 0x58, 0x59, 0x5a, 0x20, 0x07,
+  0xea, 0x00, 0x5c, 0x0d, 0xd0, 0x06, 0x00, 0x26, 0x00, 0x3b, 0x61, 0x63, 0x73, 0x70, 0x41, 0x50,
+  0x50, 0x4c, 0x13, 0x0d, 0x0f, 0x04, 0x00, 0x03, 0x21, 0xf6, 0xd6, 0x7c, 0x0d, 0x30, 0x00, 0xd3,
+  0x2d, 0x4c, 0x00, 0x0f, 0x24, 0x00, 0x03, 0x0f, 0x16, 0x00, 0x06, 0xf0, 0x0d, 0x0d, 0x64, 0x65,
+  0x73, 0x63, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x40, 0x63, 0x70, 0x72, 0x74, 0x00, 0x00,
+  0x01, 0x60, 0x00, 0x00, 0x00, 0x36, 0x77, 0x74, 0x70, 0x0c, 0x00, 0xf0, 0x0a, 0x98, 0x00, 0x00,
+  0x00, 0x14, 0x63, 0x68, 0x61, 0x64, 0x00, 0x00, 0x01, 0xac, 0x00, 0x00, 0x00, 0x2c, 0x72, 0x58,
+  0x59, 0x5a, 0x00, 0x00, 0x01, 0xd8, 0x18, 0x00, 0x12, 0x62, 0x0c, 0x00, 0x10, 0xec, 0x0c, 0x00,
+  0x11, 0x67, 0x0c, 0x00, 0x00, 0x25, 0x0e, 0x90, 0x00, 0x14, 0x72, 0x54, 0x52, 0x43, 0x00, 0x00,
+  0x02, 0x1e, 0x0e, 0x27, 0x20, 0x67, 0x0c, 0x00, 0x17, 0x62, 0x0c, 0x00, 0xf2, 0x05, 0x63, 0x68,
+  0x72, 0x6d, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00, 0x24, 0x64, 0x6d, 0x6e, 0x64, 0x00, 0x00,
+  0x02, 0x58, 0x0c, 0x00, 0x10, 0x64, 0x0c, 0x00, 0x10, 0x7c, 0x0c, 0x00, 0x43, 0x6d, 0x6c, 0x75,
+  0x63, 0xba, 0x00, 0x00, 0xa6, 0x0e, 0x50, 0x0c, 0x65, 0x6e, 0x55, 0x53, 0x18, 0x00, 0xff, 0x19,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x47, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x20, 0x00, 0x62,
+  0x00, 0x75, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x2d, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20,
+  0x00, 0x73, 0x00, 0x52, 0x00, 0x47, 0x00, 0x42, 0x40, 0x00, 0x04, 0x11, 0x1a, 0x40, 0x00, 0xf1,
+  0x06, 0x50, 0x00, 0x75, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x44,
+  0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x40, 0x00, 0x10, 0x00, 0x84, 0x01, 0x02, 0x78, 0x00, 0x06,
+  0x5c, 0x01, 0x41, 0x73, 0x66, 0x33, 0x32, 0x14, 0x00, 0xf6, 0x14, 0x01, 0x0c, 0x42, 0x00, 0x00,
+  0x05, 0xde, 0xff, 0xff, 0xf3, 0x25, 0x00, 0x00, 0x07, 0x93, 0x00, 0x00, 0xfd, 0x90, 0xff, 0xff,
+  0xfb, 0xa1, 0xff, 0xff, 0xfd, 0xa2, 0x00, 0x00, 0x03, 0xdc, 0x00, 0x00, 0xc0, 0x6e, 0x40, 0x00,
+  0xa6, 0x6f, 0xa0, 0x00, 0x00, 0x38, 0xf5, 0x00, 0x00, 0x03, 0x90, 0x14, 0x00, 0xa6, 0x24, 0x9f,
+  0x00, 0x00, 0x0f, 0x84, 0x00, 0x00, 0xb6, 0xc4, 0x14, 0x00, 0xe1, 0x62, 0x97, 0x00, 0x00, 0xb7,
+  0x87, 0x00, 0x00, 0x18, 0xd9, 0x70, 0x61, 0x72, 0x61, 0x68, 0x00, 0xf2, 0x08, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x66, 0x66, 0x00, 0x00, 0xf2, 0xa7, 0x00, 0x00, 0x0d, 0x59, 0x00, 0x00, 0x13, 0xd0,
+  0x00, 0x00, 0x0a, 0x5b, 0x38, 0x01, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf0, 0x09, 0x00, 0xa3,
+  0xd7, 0x00, 0x00, 0x54, 0x7c, 0x00, 0x00, 0x4c, 0xcd, 0x00, 0x00, 0x99, 0x9a, 0x00, 0x00, 0x26,
+  0x67, 0x00, 0x00, 0x0f, 0x5c, 0x6d, 0x42, 0x6c, 0x75, 0x63, 0x00, 0x01, 0x00, 0xff, 0x0b, 0x01,
+  0x00, 0x00, 0x00, 0x0c, 0x65, 0x6e, 0x55, 0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x47, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x50, 0x6d, 0x24, 0x00, 0x09, 0xdf, 0x73, 0x00, 0x52,
+  0x00, 0x47, 0x00, 0x42, 0xff, 0xdb, 0x00, 0x43, 0x00, 0xff, 0x01, 0x00, 0x2d, 0x4f, 0xdb, 0x00,
+  0x43, 0x01, 0x44, 0x00, 0x2d, 0xf0, 0x0b, 0xff, 0xc2, 0x00, 0x11, 0x08, 0x02, 0x58, 0x03, 0x20,
+  0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01,
+  0x01, 0xe1, 0x00, 0x02, 0xeb, 0x00, 0x01, 0x06, 0x00, 0x20, 0x01, 0x02, 0x18, 0x00, 0x1f, 0x01,
+  0x18, 0x00, 0x01, 0xf1, 0x00, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x10, 0x03, 0x10, 0x00,
+  0x00, 0x01, 0xa3, 0x20, 0x2f, 0x00, 0x70, 0x08, 0x35, 0x92, 0x96, 0x2c, 0x02, 0xc0, 0x0c, 0x00,
+  0x30, 0x09, 0x41, 0x40, 0x07, 0x00, 0x41, 0x00, 0x01, 0x00, 0x0b, 0x08, 0x00, 0x04, 0x05, 0x00,
+  0x31, 0x02, 0x8c, 0x68, 0x0b, 0x00, 0x71, 0x02, 0x2c, 0xd4, 0x0b, 0x02, 0x50, 0xb0, 0x0c, 0x00,
+  0x40, 0x00, 0x25, 0x00, 0x14, 0x09, 0x00, 0x12, 0x40, 0x3b, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00,
+  0x44, 0x96, 0x90, 0xd4, 0x94, 0xac, 0xe8, 0x0b, 0x00, 0x00, 0x0a, 0x31, 0xa0, 0x1b, 0x00, 0x93,
+  0x01, 0x0d, 0x45, 0x82, 0xa2, 0x2a, 0x0b, 0x0a, 0x58, 0x23, 0x00, 0x20, 0x25, 0x05, 0x16, 0x00,
+  0x10, 0x2e, 0x64, 0x00, 0xf0, 0x12, 0x01, 0x2c, 0x96, 0x34, 0x32, 0x68, 0xce, 0xa0, 0xa2, 0xc0,
+  0x25, 0x04, 0xa0, 0x0c, 0xeb, 0x3a, 0x94, 0x2c, 0x00, 0x00, 0x28, 0xc6, 0x80, 0x00, 0x00, 0x00,
+  0x01, 0x0d, 0x45, 0x80, 0xa2, 0x00, 0x2c, 0x2a, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x25, 0x0a, 0x08,
+  0x05, 0x04, 0x05, 0x04, 0x10, 0x00, 0x54, 0x04, 0xa0, 0x00, 0x19, 0xd2, 0x7f, 0x00, 0x01, 0x64,
+  0x00, 0x75, 0x01, 0x0b, 0x16, 0xc8, 0xb2, 0x82, 0xc0, 0x94, 0x00, 0xf3, 0x01, 0x00, 0x50, 0x80,
+  0x50, 0x40, 0x50, 0x40, 0x02, 0xc4, 0x49, 0x69, 0x0d, 0x24, 0x34, 0xcd, 0x28, 0xab, 0x00, 0x01,
+  0x4d, 0x00, 0x00, 0xc5, 0x00, 0xa4, 0x04, 0xab, 0x0b, 0x00, 0x2c, 0x16, 0x0b, 0x16, 0x20, 0xa0,
+  0x1a, 0x00, 0x21, 0x94, 0x14, 0xee, 0x00, 0x84, 0x03, 0x3a, 0x15, 0x29, 0x25, 0x16, 0x4a, 0x8a,
+  0x78, 0x00, 0xf1, 0x13, 0x00, 0x10, 0x95, 0x64, 0x29, 0x0d, 0x25, 0xb0, 0x0a, 0x31, 0xa0, 0x08,
+  0xb0, 0x35, 0x05, 0x96, 0x0b, 0x2c, 0x5c, 0xd8, 0x35, 0x00, 0xa8, 0x94, 0xa8, 0x82, 0x82, 0xc0,
+  0x00, 0x01, 0x09, 0x6a, 0x50, 0x2c, 0x00, 0x01, 0x11, 0x01, 0xda, 0x00, 0xf2, 0x1f, 0x25, 0x14,
+  0x10, 0x00, 0x94, 0x20, 0x00, 0x09, 0x40, 0xa0, 0x40, 0xa0, 0x00, 0xce, 0xa5, 0x95, 0x9d, 0x00,
+  0xb3, 0x3a, 0x89, 0x68, 0xb2, 0xc2, 0x51, 0x48, 0x52, 0x0b, 0x16, 0x59, 0x60, 0x40, 0x52, 0xc0,
+  0x2c, 0x00, 0x00, 0x94, 0x2c, 0x00, 0x49, 0x45, 0x02, 0xc8, 0xb2, 0x5a, 0x3a, 0x00, 0x04, 0x37,
+  0x01, 0xa1, 0x25, 0x08, 0x00, 0x00, 0x22, 0x94, 0x10, 0x00, 0xb0, 0x28, 0xa5, 0x00, 0xa0, 0x59,
+  0x65, 0x96, 0x00, 0x00, 0x2c, 0x02, 0xc5, 0x96, 0x58, 0x8a, 0x00, 0xf0, 0x00, 0x02, 0x16, 0x50,
+  0xb0, 0x00, 0x25, 0x89, 0x68, 0xa8, 0x59, 0x62, 0xc4, 0xa9, 0x40, 0xa0, 0x39, 0x01, 0x20, 0x00,
+  0x00, 0x6b, 0x00, 0x00, 0x72, 0x00, 0x30, 0x00, 0x00, 0x35, 0x33, 0x00, 0x90, 0x02, 0xcb, 0x25,
+  0x59, 0x48, 0x10, 0x00, 0xab, 0x2c, 0x43, 0x01, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x25, 0x52, 0x81,
+  0x00, 0x01, 0x2a, 0x59, 0x60, 0x59, 0x44, 0xb0, 0x59, 0x40, 0xe6, 0x00, 0xc1, 0x25, 0x08, 0x00,
+  0x95, 0x41, 0x00, 0x00, 0x04, 0xa5, 0x04, 0x00, 0x28, 0x58, 0x00, 0x00, 0x34, 0x00, 0x60, 0x2c,
+  0x00, 0x0b, 0x2c, 0xcd, 0x0d, 0x54, 0x00, 0x30, 0x04, 0x95, 0x40, 0x16, 0x00, 0x63, 0x4a, 0x96,
+  0x58, 0x2c, 0xb0, 0x50, 0xfa, 0x01, 0x90, 0x94, 0x20, 0x45, 0xa9, 0x49, 0x40, 0x11, 0x29, 0x41,
+  0x64, 0x00, 0x01, 0x36, 0x00, 0x71, 0x02, 0x16, 0x55, 0x82, 0xc0, 0x00, 0xb0, 0x67, 0x00, 0x10,
+  0x01, 0x99, 0x00, 0x81, 0x00, 0x00, 0x00, 0x12, 0xa5, 0x81, 0x68, 0xb9, 0x22, 0x00, 0x32, 0x00,
+  0x09, 0x42, 0x08, 0x00, 0xd2, 0x00, 0x02, 0x51, 0x41, 0x00, 0x0a, 0x0b, 0x00, 0x00, 0x05, 0x96,
+  0x58, 0x10, 0xd5, 0x00, 0x32, 0x12, 0x55, 0x00, 0x89, 0x00, 0x34, 0x4a, 0x94, 0x94, 0x5f, 0x00,
+  0x80, 0x22, 0x2c, 0x5a, 0x11, 0x28, 0x94, 0x50, 0x40, 0xfc, 0x00, 0xb2, 0x04, 0x5a, 0x10, 0x00,
+  0x02, 0x81, 0x02, 0x80, 0x59, 0x65, 0x80, 0x1f, 0x00, 0x21, 0x45, 0x16, 0x58, 0x01, 0x01, 0x61,
+  0x00, 0x12, 0x25, 0x0b, 0x00, 0xf4, 0x08, 0x09, 0x42, 0x00, 0x10, 0xa9, 0x40, 0x00, 0x11, 0x68,
+  0x40, 0x09, 0x54, 0x11, 0x29, 0x41, 0x12, 0xc5, 0xa1, 0x22, 0x94, 0x10, 0x35, 0x00, 0x33, 0x00,
+  0x13, 0x10, 0x91, 0x00, 0x00, 0x84, 0x00, 0x32, 0x4b, 0x25, 0xa8, 0xf9, 0x01, 0x70, 0x03, 0x34,
+  0x04, 0xa0, 0x00, 0x00, 0x4a, 0x14, 0x00, 0x00, 0x04, 0x00, 0x01, 0xfb, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x04, 0x94, 0x14, 0x54, 0x8a, 0x22, 0x88, 0xa2, 0x2c, 0x00, 0x00, 0x52, 0x28, 0x09, 0x00,
+  0x51, 0x28, 0x8b, 0x02, 0x89, 0x65, 0x66, 0x00, 0xf1, 0x04, 0x02, 0x50, 0x80, 0x08, 0x5a, 0x10,
+  0x00, 0x00, 0x00, 0x04, 0xa2, 0x51, 0x41, 0x09, 0x40, 0x00, 0x25, 0x02, 0x82, 0x18, 0x03, 0x60,
+  0x02, 0x16, 0x54, 0xb0, 0xa2, 0x81, 0x44, 0x00, 0x00, 0x04, 0x00, 0x51, 0x04, 0xb2, 0x5a, 0x2c,
+  0x4a, 0x07, 0x01, 0x10, 0x00, 0xbe, 0x01, 0x30, 0x12, 0xc5, 0xa1, 0xc1, 0x00, 0x01, 0xf8, 0x00,
+  0x40, 0x94, 0x50, 0xb9, 0x0a, 0x23, 0x00, 0xf0, 0x06, 0x00, 0x00, 0x4b, 0x25, 0xa2, 0xc0, 0x08,
+  0x96, 0xa0, 0xa2, 0xc0, 0x00, 0x11, 0x6a, 0x22, 0xa0, 0xa2, 0x81, 0x00, 0x42, 0x5a, 0x64, 0x01,
+  0xf2, 0x06, 0x00, 0x00, 0x02, 0x54, 0xa9, 0x65, 0x04, 0xa4, 0x96, 0x55, 0x04, 0x00, 0x00, 0x12,
+  0x94, 0x10, 0x00, 0x00, 0x8b, 0x16, 0x84, 0xc9, 0x01, 0x11, 0x00, 0x35, 0x00, 0xf2, 0x0b, 0xc4,
+  0xb2, 0x5b, 0x65, 0xcd, 0x67, 0x59, 0xab, 0x34, 0x33, 0x65, 0xb0, 0x2c, 0x4b, 0x25, 0xaa, 0xcd,
+  0x93, 0x52, 0x8a, 0x8c, 0xac, 0xd2, 0x8b, 0x99, 0x65, 0x72, 0x00, 0x16, 0x00, 0x69, 0x01, 0x01,
+  0x44, 0x00, 0x22, 0x03, 0x50, 0x70, 0x00, 0x00, 0x95, 0x00, 0xf8, 0x05, 0x4b, 0x25, 0xb6, 0x49,
+  0x6c, 0x0d, 0x32, 0x16, 0x5b, 0x02, 0xc4, 0xb2, 0x5a, 0x25, 0x40, 0xa4, 0x16, 0x5b, 0x02, 0xc9,
+  0x37, 0x00, 0x81, 0x02, 0x29, 0x41, 0x00, 0x4b, 0x16, 0xa5, 0x40, 0xaf, 0x00, 0x00, 0xa3, 0x01,
+  0x01, 0x3b, 0x00, 0x31, 0x4b, 0x25, 0xa2, 0x75, 0x00, 0xf2, 0x02, 0x66, 0xaa, 0x88, 0xcd, 0x97,
+  0x50, 0x2c, 0x09, 0x68, 0xcd, 0x44, 0xad, 0x22, 0x25, 0x97, 0x50, 0x41, 0x14, 0x01, 0x10, 0x00,
+  0xb3, 0x00, 0x11, 0xb2, 0x16, 0x01, 0x00, 0xb1, 0x00, 0x23, 0x85, 0xa1, 0x14, 0x01, 0x03, 0xaf,
+  0x00, 0xf2, 0x00, 0xa5, 0x8a, 0x88, 0xa0, 0x09, 0x40, 0x2c, 0x4a, 0x96, 0x28, 0x8a, 0x22, 0x80,
+  0xb1, 0x2c, 0x4a, 0x02, 0x01, 0x58, 0x00, 0x40, 0x94, 0x00, 0x80, 0x00, 0xa3, 0x00, 0x21, 0x28,
+  0x00, 0x5c, 0x01, 0x01, 0x14, 0x00, 0x00, 0xa6, 0x00, 0x01, 0x09, 0x00, 0x00, 0xdb, 0x01, 0x22,
+  0xc9, 0x68, 0x16, 0x02, 0x00, 0x11, 0x00, 0x83, 0x04, 0xb2, 0x6a, 0xa2, 0x2a, 0x0a, 0x2c, 0x04,
+  0x3e, 0x01, 0x00, 0x13, 0x00, 0x01, 0x0f, 0x01, 0xae, 0xc8, 0x59, 0x62, 0x88, 0xa2, 0x28, 0x8b,
+  0x16, 0x8b, 0x90, 0x32, 0x00, 0x56, 0x68, 0x20, 0x0a, 0x96, 0xc0, 0x43, 0x00, 0x00, 0xb7, 0x01,
+  0x70, 0xb2, 0x5a, 0x2c, 0x96, 0x59, 0x42, 0xc0, 0x6d, 0x01, 0xd2, 0x85, 0xce, 0x8a, 0x8c, 0xad,
+  0xac, 0xb5, 0x92, 0x8d, 0x65, 0x2c, 0x96, 0x8b, 0x50, 0x00, 0x00, 0x06, 0x00, 0x46, 0x83, 0x3a,
+  0x00, 0x05, 0x36, 0x00, 0x00, 0x54, 0x01, 0x71, 0x9a, 0x00, 0x2e, 0x40, 0x4b, 0x25, 0xa2, 0x2a,
+  0x01, 0xc5, 0x09, 0x65, 0x94, 0x2c, 0x9a, 0xcb, 0x3a, 0xd4, 0x82, 0xdc, 0x8b, 0x02, 0x39, 0x00,
+  0xf0, 0x29, 0x17, 0x3b, 0x82, 0xc0, 0xb0, 0x10, 0x00, 0x00, 0x09, 0x60, 0x94, 0x00, 0x16, 0x2a,
+  0x8b, 0x90, 0x94, 0x00, 0xb0, 0x00, 0x02, 0x50, 0x02, 0xc0, 0x9a, 0x09, 0x42, 0xc0, 0xb9, 0x01,
+  0x63, 0x3a, 0x05, 0x0d, 0x60, 0x04, 0x25, 0xa4, 0x16, 0x0a, 0x82, 0x8b, 0x00, 0x96, 0x59, 0x42,
+  0xc9, 0x66, 0xb3, 0xa4, 0xb9, 0x8b, 0x42, 0x0d, 0x40, 0xb1, 0x78, 0x00, 0xf0, 0x19, 0x09, 0x45,
+  0x9a, 0x80, 0x0b, 0x90, 0x94, 0x28, 0x2e, 0x40, 0x05, 0x04, 0x01, 0x2c, 0x94, 0x25, 0x00, 0x00,
+  0x28, 0xd6, 0x43, 0x3b, 0x00, 0x35, 0x90, 0x40, 0x94, 0x26, 0xac, 0x00, 0xb9, 0x00, 0x25, 0x0b,
+  0x02, 0xc0, 0x03, 0x34, 0x35, 0x00, 0x62, 0x02, 0xe1, 0x28, 0x8b, 0x0a, 0x2c, 0x4b, 0x25, 0x50,
+  0x0b, 0x26, 0xb3, 0x73, 0xa4, 0x0a, 0x81, 0xff, 0x01, 0xf0, 0x22, 0xa2, 0xc0, 0x02, 0x50, 0x94,
+  0x28, 0x10, 0x20, 0x35, 0x00, 0x09, 0xa0, 0x94, 0x2c, 0x0b, 0x94, 0x26, 0x82, 0x00, 0x00, 0x0a,
+  0x35, 0x90, 0x94, 0x25, 0x0b, 0x01, 0x02, 0x83, 0x34, 0x28, 0x2c, 0x00, 0x33, 0x42, 0x82, 0xc0,
+  0x80, 0x94, 0x2c, 0x0a, 0x02, 0x59, 0x65, 0x4b, 0x0a, 0x2c, 0x05, 0x04, 0x77, 0x02, 0x00, 0xe7,
+  0x00, 0x01, 0x08, 0x00, 0xf0, 0x08, 0x09, 0x40, 0x00, 0x20, 0x00, 0xa0, 0x94, 0x00, 0xa0, 0xb2,
+  0x0c, 0xd0, 0x00, 0x00, 0x0a, 0x2c, 0x00, 0x20, 0x00, 0xd4, 0x0c, 0xd0, 0x02, 0x32, 0x00, 0x54,
+  0x01, 0x2c, 0xa9, 0x54, 0x20, 0x37, 0x00, 0x13, 0x00, 0x97, 0x01, 0xa0, 0x05, 0x01, 0x08, 0xa2,
+  0xc0, 0x02, 0x02, 0x50, 0x02, 0x82, 0x02, 0x00, 0xf0, 0x19, 0xc2, 0x59, 0x42, 0xc8, 0xb3, 0x3a,
+  0x00, 0x00, 0x00, 0xa8, 0xb2, 0xa0, 0xa8, 0x2a, 0x22, 0xa2, 0x96, 0x0a, 0x88, 0xb0, 0x02, 0xa9,
+  0x12, 0xa1, 0x6c, 0x20, 0x28, 0x00, 0x2a, 0x54, 0x00, 0x85, 0x09, 0x40, 0x0a, 0x00, 0x00, 0x80,
+  0xa0, 0x02, 0xb4, 0x05, 0xa0, 0x02, 0x80, 0x01, 0x62, 0x16, 0x2a, 0xa0, 0xa8, 0x8a, 0x8a, 0x03,
+  0x00, 0x6a, 0x16, 0x0a, 0x80, 0x14, 0x10, 0x25, 0xcc, 0x01, 0x00, 0x95, 0x00, 0x0f, 0x04, 0x00,
+  0x25, 0x21, 0x09, 0x42, 0x86, 0x03, 0x0f, 0x3f, 0x00, 0x25, 0x0f, 0x38, 0x00, 0x74, 0x6b, 0x3f,
+  0xff, 0xc4, 0x00, 0x14, 0x10, 0xac, 0x07, 0xf6, 0x0a, 0x00, 0xc0, 0xff, 0xda, 0x00, 0x08, 0x01,
+  0x01, 0x00, 0x01, 0x05, 0x02, 0x6a, 0x67, 0xff, 0xc4, 0x00, 0x1e, 0x11, 0x00, 0x02, 0x01, 0x05,
+  0x00, 0x03, 0xb5, 0x00, 0xb1, 0x01, 0x11, 0x40, 0x00, 0x10, 0x20, 0x30, 0x50, 0x21, 0x60, 0x80,
+  0x2c, 0x00, 0xf0, 0x4c, 0x03, 0x01, 0x01, 0x3f, 0x01, 0xfa, 0x15, 0xec, 0x1d, 0x21, 0x0c, 0xef,
+  0x50, 0x07, 0x48, 0x7a, 0xc3, 0xc1, 0x73, 0x55, 0xd6, 0x03, 0xd1, 0xbc, 0x57, 0x8c, 0x5d, 0x38,
+  0xa6, 0x70, 0x92, 0xf5, 0x89, 0x02, 0xe6, 0x38, 0xc8, 0xd8, 0x4b, 0x31, 0x4e, 0x46, 0xc6, 0x08,
+  0x92, 0x72, 0x3b, 0x86, 0x87, 0x65, 0x05, 0xd3, 0x96, 0x78, 0x03, 0x94, 0xe5, 0x18, 0xa7, 0x90,
+  0xb0, 0x54, 0xb1, 0x33, 0xd5, 0x2c, 0x15, 0x2b, 0x0b, 0x1d, 0xa7, 0x7b, 0xc8, 0x6d, 0x3c, 0x11,
+  0x65, 0xa1, 0xc2, 0x12, 0x1f, 0x49, 0x7d, 0x41, 0xff, 0xc4, 0x00, 0x20, 0x11, 0x00, 0x02, 0x01,
+  0x00, 0x06, 0x7a, 0x00, 0xd1, 0x01, 0x50, 0x00, 0x11, 0x10, 0x20, 0x21, 0x31, 0x30, 0x80, 0x41,
+  0x60, 0x70, 0x7b, 0x00, 0x10, 0x02, 0x7b, 0x00, 0xff, 0x28, 0xf1, 0x5c, 0xbf, 0xb0, 0xd6, 0x2a,
+  0x73, 0x39, 0x9c, 0xae, 0xb5, 0xfd, 0x4b, 0x5d, 0x52, 0xb4, 0xe9, 0x65, 0x69, 0xd6, 0x6a, 0x5a,
+  0x8a, 0xc1, 0xc1, 0xc8, 0x58, 0x61, 0xc8, 0x5c, 0x74, 0x0b, 0x44, 0x3a, 0x05, 0xc7, 0x4f, 0x95,
+  0xc5, 0x91, 0x64, 0x7d, 0x3c, 0x2b, 0xeb, 0xf1, 0x92, 0xc8, 0xb2, 0x39, 0x0c, 0x69, 0xc9, 0xf7,
+  0x6b, 0xfe, 0x00, 0x0a, 0x22, 0x06, 0x3f, 0xfe, 0x00, 0x86, 0x1f, 0x10, 0x00, 0x02, 0x03, 0x00,
+  0x01, 0x05, 0x26, 0x01, 0xc1, 0x01, 0x11, 0x00, 0x10, 0x60, 0x30, 0x20, 0x40, 0x70, 0x80, 0xb0,
+  0x90, 0x84, 0x00, 0xf3, 0x3d, 0x01, 0x00, 0x01, 0x3f, 0x21, 0xf4, 0x79, 0xdb, 0xcf, 0x9a, 0x56,
+  0xb2, 0x87, 0x48, 0x7a, 0x87, 0xa3, 0x2f, 0x48, 0xa9, 0xe9, 0x15, 0x8e, 0xe9, 0xc7, 0x4f, 0x0c,
+  0x60, 0xee, 0x4d, 0x2f, 0x26, 0x1f, 0x86, 0x02, 0x8a, 0xd6, 0x50, 0x73, 0x18, 0x2c, 0xe7, 0x9c,
+  0x76, 0xe3, 0xc9, 0xae, 0x45, 0x15, 0xa8, 0xb2, 0xc3, 0x80, 0x59, 0x83, 0x30, 0x39, 0x5e, 0x61,
+  0xfe, 0x61, 0x8b, 0x1a, 0x33, 0x07, 0x91, 0x45, 0x18, 0x28, 0xe9, 0x0e, 0x89, 0xfc, 0x03, 0xbf,
+  0xff, 0x0f, 0x09, 0x01, 0x6e, 0x01, 0xf0, 0x04, 0x10, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xb4,
+  0xb0, 0x44, 0x04, 0x10, 0x41, 0x04, 0x10, 0x52, 0xf3, 0xcf, 0x3c, 0x03, 0x00, 0x21, 0x3a, 0x81,
+  0x0f, 0x00, 0x13, 0x41, 0x06, 0x00, 0x10, 0x1f, 0x24, 0x00, 0x52, 0xf7, 0xdf, 0x64, 0x07, 0x20,
+  0x12, 0x00, 0x20, 0x57, 0xf7, 0x27, 0x00, 0x20, 0x0f, 0x88, 0x33, 0x00, 0x00, 0x12, 0x00, 0x61,
+  0x79, 0xe6, 0x8a, 0x04, 0x10, 0x41, 0x4b, 0x00, 0x60, 0x7a, 0xc2, 0x20, 0xcf, 0x76, 0xd0, 0x15,
+  0x00, 0x71, 0x04, 0x17, 0x7c, 0xf3, 0xcf, 0x3c, 0xf0, 0x24, 0x00, 0xa1, 0x0b, 0x2e, 0xea, 0x04,
+  0x10, 0x41, 0x06, 0xa0, 0x41, 0x04, 0x4b, 0x00, 0x41, 0xe4, 0x29, 0x21, 0x28, 0x18, 0x00, 0x90,
+  0x04, 0x10, 0x52, 0x03, 0x5f, 0x1b, 0xf2, 0x36, 0xc1, 0x69, 0x00, 0x33, 0x14, 0x41, 0x05, 0x60,
+  0x00, 0x01, 0x4b, 0x00, 0x44, 0x66, 0xc6, 0x04, 0x18, 0x87, 0x00, 0x93, 0x0b, 0x7c, 0x77, 0xcc,
+  0xe2, 0x05, 0xe5, 0xc6, 0x38, 0x36, 0x00, 0x01, 0x60, 0x00, 0x80, 0x1f, 0x7d, 0xf7, 0x44, 0x06,
+  0x0a, 0x22, 0xca, 0x3c, 0x00, 0xd4, 0x10, 0x41, 0x04, 0x11, 0xbc, 0xf3, 0xc3, 0xfb, 0x04, 0x10,
+  0x60, 0x44, 0x0c, 0x36, 0x00, 0xf0, 0x0b, 0x10, 0x42, 0x2d, 0xf2, 0x41, 0xf7, 0xa8, 0xc1, 0x40,
+  0x14, 0xc1, 0x04, 0x58, 0xce, 0x04, 0x10, 0x41, 0x74, 0xa0, 0x41, 0x7e, 0xff, 0x00, 0x3c, 0xf2,
+  0xb0, 0x40, 0x00, 0xf2, 0x12, 0x00, 0x10, 0x42, 0x08, 0x20, 0x8b, 0x00, 0x30, 0x41, 0x06, 0xa4,
+  0x81, 0x98, 0x1c, 0x02, 0x40, 0x10, 0x0b, 0x4a, 0x00, 0x41, 0x07, 0x20, 0x41, 0x1b, 0x90, 0x75,
+  0x04, 0x14, 0xb7, 0xf3, 0xcb, 0xe2, 0x58, 0x00, 0x72, 0x00, 0x20, 0x82, 0x0b, 0x20, 0x82, 0x0c,
+  0x79, 0x00, 0x50, 0x01, 0x2a, 0x5a, 0x20, 0x61, 0x18, 0x00, 0x80, 0x1e, 0x41, 0x04, 0x1b, 0x40,
+  0xe3, 0x52, 0x80, 0x0c, 0x00, 0xa1, 0x10, 0x41, 0x04, 0x20, 0x82, 0x0a, 0x30, 0x82, 0x0c, 0x20,
+  0x79, 0x00, 0x51, 0x15, 0x40, 0x0e, 0x34, 0x40, 0x18, 0x00, 0x82, 0x5d, 0x80, 0x10, 0x41, 0x4a,
+  0xda, 0xd6, 0xa8, 0x3c, 0x00, 0xa1, 0x10, 0x02, 0x08, 0xa0, 0x83, 0x08, 0x24, 0x83, 0x08, 0x00,
+  0x7e, 0x00, 0x40, 0x00, 0x41, 0x04, 0x30, 0x09, 0x00, 0x10, 0x1a, 0xf4, 0x00, 0x31, 0x52, 0xb5,
+  0x68, 0x3c, 0x00, 0xa1, 0x10, 0x42, 0x08, 0x62, 0xa2, 0x09, 0x20, 0xc2, 0x08, 0x20, 0x27, 0x00,
+  0x50, 0x18, 0xc0, 0x04, 0x10, 0x5d, 0x4b, 0x00, 0x10, 0x16, 0x2a, 0x00, 0x30, 0x04, 0x14, 0xbc,
+  0x0c, 0x00, 0xa0, 0x10, 0x41, 0x04, 0x00, 0x82, 0x08, 0x20, 0xc2, 0x08, 0x30, 0x75, 0x00, 0x51,
+  0x00, 0x10, 0x41, 0x04, 0x0a, 0x3f, 0x01, 0x22, 0x10, 0x46, 0x90, 0x01, 0x22, 0x05, 0x22, 0x4b,
+  0x00, 0xf2, 0x01, 0x40, 0x0b, 0x70, 0x93, 0x88, 0x20, 0xb2, 0x08, 0x20, 0x86, 0x08, 0x20, 0x80,
+  0x0c, 0x10, 0x40, 0x87, 0x00, 0x21, 0x13, 0x90, 0x4b, 0x00, 0x41, 0x10, 0x41, 0x48, 0xa0, 0x09,
+  0x00, 0xf1, 0x01, 0x20, 0x82, 0x1c, 0xb0, 0x82, 0x18, 0x20, 0x8a, 0x09, 0x20, 0x96, 0x0f, 0x30,
+  0x81, 0x04, 0x0a, 0x3c, 0x00, 0x11, 0x5e, 0x1b, 0x00, 0x00, 0xb7, 0x00, 0x20, 0x57, 0x3c, 0x06,
+  0x00, 0x60, 0x41, 0x08, 0x24, 0xc3, 0x08, 0x24, 0x72, 0x00, 0x32, 0x08, 0x20, 0x82, 0xc0, 0x00,
+  0xa0, 0x04, 0x11, 0xbc, 0xe7, 0x3c, 0xf3, 0xdf, 0xff, 0x00, 0xfb, 0x0b, 0x02, 0x21, 0x5c, 0xeb,
+  0x9a, 0x00, 0xd1, 0x02, 0x08, 0xf0, 0x82, 0x08, 0x20, 0x82, 0x4e, 0x20, 0xcb, 0x08, 0x22, 0xc0,
+  0x12, 0x00, 0x42, 0x41, 0xe5, 0x60, 0x01, 0x09, 0x00, 0x41, 0x04, 0x10, 0x57, 0x05, 0xf1, 0x00,
+  0xd1, 0x00, 0x20, 0x83, 0x09, 0x70, 0x86, 0x0c, 0x30, 0x82, 0x0e, 0x20, 0x83, 0x88, 0x12, 0x00,
+  0xd2, 0x04, 0x10, 0x57, 0x04, 0x13, 0x8e, 0x04, 0x10, 0x44, 0x38, 0xe0, 0x01, 0x05, 0x3c, 0x02,
+  0xc2, 0x10, 0x12, 0x89, 0x3a, 0x82, 0x08, 0x30, 0x92, 0x0c, 0x20, 0x82, 0xdc, 0x57, 0x01, 0xe3,
+  0x10, 0x41, 0x05, 0x70, 0x56, 0x3c, 0x57, 0x6b, 0x05, 0x5f, 0xf1, 0xbf, 0xc0, 0x6b, 0x54, 0x00,
+  0x00, 0x09, 0x01, 0x81, 0x82, 0x08, 0x20, 0x83, 0xa8, 0x20, 0x82, 0x08, 0xa9, 0x00, 0x00, 0x66,
+  0x00, 0x91, 0x61, 0x73, 0xc6, 0x10, 0x55, 0xf5, 0xfd, 0x61, 0x06, 0xe7, 0x01, 0x10, 0x04, 0xe7,
+  0x01, 0x93, 0xb3, 0x08, 0x25, 0x8b, 0x08, 0x60, 0x82, 0x08, 0x20, 0x8d, 0x00, 0xc3, 0x05, 0x70,
+  0x56, 0xdd, 0x93, 0x69, 0x04, 0x1c, 0x4d, 0xae, 0xb1, 0xaa, 0x4b, 0x00, 0xb4, 0x10, 0x17, 0x0c,
+  0x20, 0x82, 0x08, 0x20, 0x92, 0x08, 0xe0, 0x82, 0x12, 0x00, 0xb0, 0x57, 0x05, 0x0c, 0xf3, 0x06,
+  0x20, 0x52, 0xcf, 0x2c, 0x81, 0x5a, 0xa5, 0x01, 0x01, 0x15, 0x01, 0x75, 0x20, 0x02, 0x08, 0x3a,
+  0xc2, 0x08, 0x20, 0x24, 0x00, 0x31, 0x41, 0x05, 0x70, 0x18, 0x00, 0x42, 0x10, 0x41, 0x04, 0x15,
+  0x87, 0x01, 0x00, 0x0f, 0x00, 0x43, 0x05, 0x43, 0x8e, 0x00, 0xdb, 0x00, 0x00, 0x0f, 0x00, 0x80,
+  0x04, 0x10, 0x57, 0x07, 0x9c, 0xf3, 0xcf, 0x40, 0x0c, 0x00, 0x13, 0x5c, 0xa8, 0x00, 0x76, 0x41,
+  0x04, 0x10, 0x54, 0xff, 0x00, 0xf2, 0x34, 0x00, 0x10, 0x04, 0xe2, 0x00, 0x87, 0x6b, 0x04, 0x10,
+  0x5d, 0x07, 0xe2, 0xf5, 0xd8, 0x4c, 0x00, 0x63, 0x07, 0xff, 0x00, 0xff, 0x00, 0xa4, 0x36, 0x00,
+  0xf1, 0x01, 0x4f, 0x04, 0x10, 0x44, 0x20, 0x10, 0x57, 0x06, 0xb0, 0x41, 0x06, 0xb0, 0x6e, 0xe5,
+  0xdd, 0x81, 0x4e, 0x00, 0x20, 0x5a, 0x34, 0x53, 0x02, 0xf0, 0x18, 0xbf, 0xff, 0x00, 0xfb, 0x01,
+  0x0c, 0xb0, 0x41, 0x04, 0x72, 0xc1, 0x57, 0xca, 0x41, 0x06, 0xfe, 0x81, 0x05, 0xf1, 0xaf, 0x38,
+  0x10, 0x6b, 0x07, 0xab, 0xf7, 0x84, 0x15, 0xc1, 0x04, 0x26, 0xae, 0x0b, 0xfc, 0x41, 0x04, 0x00,
+  0x41, 0x5f, 0x4e, 0x00, 0xf0, 0x15, 0xf8, 0x1f, 0xbe, 0x00, 0x10, 0xb6, 0x72, 0x10, 0xbe, 0xac,
+  0x10, 0x7f, 0x04, 0x10, 0x7b, 0x5b, 0x2d, 0x41, 0x5a, 0x20, 0x6a, 0xbb, 0xea, 0x81, 0x5c, 0x10,
+  0x42, 0xde, 0x80, 0xab, 0x04, 0x11, 0x3e, 0x34, 0x17, 0x3f, 0x28, 0x00, 0xf2, 0x02, 0xc1, 0x4f,
+  0xe3, 0x0b, 0x07, 0xf0, 0x81, 0x07, 0xf3, 0x09, 0x5f, 0xf2, 0xc1, 0x06, 0xb5, 0xc1, 0x00, 0x97,
+  0x00, 0xb0, 0x15, 0xc1, 0x04, 0x15, 0x28, 0x0b, 0xfe, 0xc6, 0xfb, 0x3c, 0x40, 0x26, 0x00, 0xf1,
+  0x05, 0xff, 0x00, 0xfc, 0x21, 0xbf, 0xf4, 0x1f, 0xfd, 0xa0, 0x15, 0xfd, 0xf6, 0x76, 0x33, 0x8c,
+  0x10, 0x6b, 0x5c, 0x10, 0x41, 0x98, 0x00, 0xc2, 0x00, 0x74, 0x10, 0x43, 0xf7, 0xf1, 0x3d, 0xa3,
+  0xfb, 0x01, 0x2c, 0x1d, 0x29, 0x00, 0xf6, 0x18, 0xc2, 0x3b, 0x8e, 0xc2, 0x83, 0xfe, 0xf0, 0x1c,
+  0x04, 0xc0, 0x01, 0x02, 0xc3, 0x2b, 0xff, 0x00, 0xfc, 0xf3, 0x8c, 0xb0, 0xc3, 0x2c, 0xb2, 0xcb,
+  0x28, 0xc0, 0xc3, 0x08, 0xe0, 0x00, 0x35, 0x3f, 0x84, 0x28, 0x45, 0xe3, 0x1e, 0xf3, 0x84, 0x07,
+  0x06, 0x00, 0x67, 0x07, 0x10, 0x04, 0x9c, 0x0a, 0x09, 0x13, 0x00, 0x20, 0x00, 0x10, 0xc1, 0x0b,
+  0x0a, 0x13, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x11, 0x14, 0x90, 0x0d, 0x0f, 0x19, 0x00, 0x00, 0x09,
+  0x13, 0x00, 0x02, 0xec, 0x0b, 0x09, 0x13, 0x00, 0x0f, 0x0d, 0x00, 0x7a, 0xe1, 0xff, 0xc4, 0x00,
+  0x23, 0x11, 0x01, 0x00, 0x02, 0x02, 0x03, 0x00, 0x03, 0x01, 0x01, 0xb6, 0x05, 0xf0, 0x0b, 0x00,
+  0x00, 0x01, 0x00, 0x11, 0x10, 0x31, 0x20, 0x21, 0x30, 0x40, 0x41, 0x51, 0x61, 0x71, 0x60, 0x80,
+  0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0xf0, 0xff, 0x1f, 0x3f, 0x10, 0xf2, 0xa9,
+  0x4f, 0x80, 0xf9, 0x5c, 0x7e, 0x6a, 0x62, 0xfc, 0x86, 0x77, 0xce, 0xa2, 0xfa, 0x07, 0xdb, 0x3a,
+  0x65, 0x11, 0x2b, 0xd5, 0x6e, 0x5d, 0x4b, 0xfe, 0x4b, 0x3f, 0x27, 0x53, 0xaf, 0x1f, 0xfd, 0xf6,
+  0x37, 0x2e, 0x2d, 0x4d, 0x99, 0xb9, 0xac, 0x3f, 0x5e, 0x8b, 0x70, 0x7e, 0x99, 0x5f, 0x92, 0xbc,
+  0xcd, 0xc6, 0x18, 0xef, 0x0d, 0xcd, 0x79, 0x8f, 0xc0, 0x5a, 0x9b, 0xdb, 0x13, 0x37, 0xeb, 0xfe,
+  0x4e, 0xf1, 0x72, 0xf1, 0x53, 0xa9, 0x52, 0xbe, 0x2a, 0xd4, 0xb7, 0x09, 0x50, 0x6a, 0x74, 0xca,
+  0xaf, 0x30, 0xe1, 0x51, 0xeb, 0xae, 0x17, 0x8b, 0x9f, 0x5e, 0xbd, 0x7d, 0xca, 0x19, 0xd7, 0x0b,
+  0x8b, 0x80, 0xbb, 0xc6, 0xcf, 0xee, 0x6f, 0xf6, 0x57, 0xe4, 0xa7, 0x8d, 0x04, 0x4a, 0xc9, 0xa9,
+  0x5d, 0xf0, 0x79, 0xdf, 0x3a, 0x6a, 0xf9, 0x30, 0xeb, 0x0f, 0xee, 0x2e, 0x05, 0xc3, 0x06, 0xf0,
+  0x75, 0x1f, 0xde, 0x16, 0xe4, 0x2e, 0x58, 0x6b, 0x07, 0x65, 0x67, 0x52, 0xce, 0x0f, 0xb6, 0x95,
+  0xea, 0x37, 0x1d, 0xc3, 0x71, 0xde, 0x0f, 0xc7, 0x9b, 0xd1, 0x5c, 0x36, 0x61, 0x6a, 0x5d, 0xfd,
+  0x47, 0xa6, 0x5b, 0xec, 0xa5, 0x66, 0xaf, 0xc9, 0xd1, 0x36, 0xe0, 0xf8, 0x05, 0x77, 0x1e, 0xf8,
+  0x0d, 0x4a, 0xfb, 0x30, 0x37, 0x1d, 0xfa, 0xda, 0xaf, 0x15, 0x91, 0xa8, 0xf6, 0xf8, 0xbb, 0x9b,
+  0x70, 0x74, 0x73, 0x0b, 0x8b, 0xc8, 0x63, 0x0d, 0xc7, 0x7e, 0x61, 0x6c, 0x4a, 0x65, 0xb5, 0x58,
+  0x1a, 0x3d, 0x77, 0x36, 0xe1, 0xf5, 0xcf, 0x47, 0x80, 0xd4, 0xeb, 0x7f, 0x0a, 0x9a, 0xbe, 0x0a,
+  0x27, 0x81, 0xb8, 0xf8, 0x84, 0x5b, 0xf1, 0x18, 0x9e, 0x62, 0x56, 0x06, 0x98, 0xb7, 0x9d, 0x2b,
+  0x86, 0x97, 0xe0, 0x6e, 0x3b, 0xf0, 0x3b, 0x8f, 0x5d, 0x79, 0x8c, 0x4f, 0x30, 0xb8, 0x95, 0x92,
+  0xd9, 0x68, 0x62, 0xda, 0xac, 0x53, 0xee, 0x3b, 0xea, 0x75, 0x5c, 0x0d, 0xc7, 0x7e, 0x1a, 0xf4,
+  0xa8, 0x5c, 0x4f, 0xcf, 0x21, 0xa8, 0xb7, 0x91, 0x4c, 0xda, 0xf8, 0x3e, 0x21, 0x73, 0xad, 0x4b,
+  0x97, 0xfc, 0x96, 0x7e, 0x4b, 0x3f, 0x27, 0x59, 0x3a, 0x07, 0x00, 0xf2, 0xff, 0x4c, 0x25, 0xff,
+  0x00, 0x32, 0x0d, 0xcb, 0xa6, 0x27, 0xdf, 0x90, 0x09, 0xcc, 0xdc, 0x43, 0x84, 0x4c, 0xa2, 0x47,
+  0xc5, 0xeb, 0xa8, 0x6e, 0x3b, 0xf7, 0x0f, 0xef, 0xa1, 0x55, 0x80, 0xb8, 0xf4, 0xca, 0x5e, 0x0b,
+  0x79, 0x6c, 0x7b, 0x29, 0x94, 0xf0, 0xab, 0x94, 0xca, 0x65, 0x64, 0xd7, 0x95, 0x2f, 0xb8, 0xd5,
+  0xf5, 0x0a, 0xbe, 0xe5, 0x3e, 0xb8, 0x8d, 0x71, 0xea, 0xbd, 0xc6, 0xfc, 0x87, 0x58, 0x74, 0x7c,
+  0x42, 0xaf, 0xb9, 0x4f, 0xaf, 0x73, 0x4e, 0x0d, 0xf2, 0x1a, 0xf8, 0x01, 0xc2, 0xca, 0xcd, 0x3e,
+  0xe3, 0x57, 0xd6, 0x29, 0xab, 0xf8, 0x06, 0x9c, 0x1b, 0xe4, 0x35, 0xc4, 0x6e, 0x3b, 0xf4, 0xa4,
+  0x77, 0xce, 0xd5, 0x58, 0xd3, 0xd8, 0xd3, 0x81, 0xac, 0x96, 0x45, 0xbc, 0x0d, 0x4b, 0x96, 0xcb,
+  0x70, 0x6e, 0x3b, 0xf8, 0x06, 0xe2, 0x1c, 0xde, 0x2d, 0xd7, 0xb1, 0xa7, 0xe6, 0x0d, 0x4a, 0x95,
+  0x1f, 0x86, 0x69, 0xc7, 0x44, 0xb3, 0xf2, 0x5f, 0xf3, 0x01, 0xbe, 0x66, 0x9f, 0x73, 0x5f, 0x18,
+  0x69, 0xe4, 0xd1, 0x83, 0x5c, 0x4d, 0x3f, 0x09, 0xf2, 0xdc, 0xb4, 0xaa, 0xc9, 0xfa, 0x88, 0xc9,
+  0xa7, 0x91, 0xd1, 0x83, 0x59, 0x75, 0x83, 0x4f, 0x3d, 0x44, 0x18, 0xf5, 0xc4, 0xdf, 0x07, 0x58,
+  0xb4, 0x69, 0x9d, 0xcf, 0xf5, 0x1f, 0xc4, 0xd4, 0x05, 0x63, 0x4c, 0xec, 0x8b, 0x59, 0xfa, 0x86,
+  0xe2, 0x2b, 0x29, 0xe2, 0x35, 0x97, 0x58, 0x34, 0xe4, 0x2d, 0x9a, 0xc1, 0xd3, 0x2c, 0x88, 0xcd,
+  0x3e, 0x67, 0x6e, 0x06, 0x9e, 0x01, 0x48, 0x31, 0x6f, 0x9f, 0xd4, 0x37, 0x15, 0x86, 0x0d, 0xc7,
+  0x78, 0xfa, 0x96, 0x4b, 0x22, 0xe0, 0xd3, 0x91, 0xa6, 0x59, 0x17, 0xea, 0x11, 0xc8, 0xc2, 0x1c,
+  0x1a, 0xe4, 0x52, 0x5c, 0xac, 0x92, 0xdf, 0xdc, 0x9a, 0x95, 0x83, 0x09, 0x59, 0x74, 0x71, 0x1e,
+  0x06, 0x9e, 0x04, 0x77, 0x96, 0x04, 0xba, 0x96, 0x44, 0x4f, 0xb9, 0x5c, 0x5d, 0xf1, 0x30, 0x9c,
+  0x89, 0x7c, 0x1d, 0x10, 0xd3, 0xc0, 0xd3, 0xca, 0x99, 0x4c, 0xfa, 0xe5, 0x58, 0x77, 0x87, 0x0d,
+  0x0b, 0xc5, 0xd9, 0xc5, 0xe1, 0x5c, 0x6b, 0x95, 0x62, 0xb3, 0x44, 0xa2, 0x75, 0x2c, 0x96, 0x4b,
+  0x25, 0x92, 0xc9, 0x72, 0xe5, 0xcb, 0xf3, 0xa9, 0x6a, 0x54, 0x0b, 0x62, 0x56, 0xa5, 0xc6, 0xaa,
+  0x5f, 0xfc, 0x84, 0x2d, 0x89, 0x5f, 0xf4, 0x1f, 0xff, 0xc4, 0x00, 0x22, 0x11, 0x00, 0x02, 0x02,
+  0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0xf0, 0xde, 0x01, 0x11, 0x31, 0x10,
+  0x30, 0x20, 0x21, 0x40, 0x41, 0x51, 0x61, 0x71, 0x80, 0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x02,
+  0x01, 0x01, 0x3f, 0x10, 0xd2, 0xa8, 0xfe, 0x19, 0x0d, 0x11, 0xaa, 0x05, 0xe6, 0xa6, 0xab, 0x10,
+  0xbe, 0x6a, 0x7a, 0x27, 0xcc, 0x4a, 0x44, 0x8b, 0xfa, 0x34, 0x99, 0x2f, 0x4c, 0x8f, 0xa2, 0x3e,
+  0x88, 0xfa, 0xf1, 0xd9, 0x1a, 0x16, 0xc4, 0xa1, 0x0d, 0x7b, 0x56, 0x7e, 0x90, 0x9a, 0x75, 0xad,
+  0xe1, 0xe3, 0xac, 0xdf, 0x96, 0x93, 0x67, 0xe1, 0x4f, 0xe8, 0x91, 0xe5, 0x24, 0xbc, 0x08, 0x23,
+  0x3d, 0x92, 0x4f, 0x8a, 0x99, 0x89, 0x3f, 0xa3, 0xe9, 0x09, 0xc8, 0xd2, 0x67, 0x76, 0xed, 0x09,
+  0xa7, 0xad, 0xf0, 0x9d, 0x1e, 0xf7, 0xf7, 0xc2, 0x1b, 0x17, 0xd6, 0x1b, 0x86, 0xbe, 0x62, 0xdf,
+  0x8f, 0x2f, 0xd9, 0x74, 0x74, 0xb4, 0x26, 0x9f, 0x1b, 0x13, 0xd0, 0xb5, 0x37, 0xc6, 0x78, 0xac,
+  0xac, 0x24, 0xfe, 0x8d, 0xc0, 0xd1, 0x11, 0x8a, 0x0a, 0x86, 0xa5, 0x0d, 0xeb, 0xe7, 0x08, 0x57,
+  0x96, 0xc8, 0xc3, 0xeb, 0xbd, 0x0b, 0x4b, 0x7a, 0x13, 0xd3, 0x4f, 0xfa, 0x50, 0x5d, 0xa4, 0x3a,
+  0x65, 0x16, 0x1a, 0xee, 0x57, 0x3b, 0x7c, 0x2b, 0x09, 0x49, 0x02, 0x23, 0x54, 0xf8, 0x2a, 0xdb,
+  0x28, 0x7a, 0x12, 0x81, 0x94, 0xd0, 0xfe, 0x71, 0x64, 0xfa, 0x10, 0xe8, 0x55, 0xa9, 0xbd, 0x69,
+  0xf3, 0xa1, 0x41, 0x66, 0xcd, 0x73, 0x62, 0xe4, 0xc4, 0x3a, 0x15, 0x69, 0x7b, 0x93, 0xfb, 0xc5,
+  0x28, 0x28, 0x2a, 0xd4, 0xb7, 0xa1, 0xa3, 0xf3, 0x53, 0xbd, 0xe9, 0xf1, 0xa0, 0xa9, 0x7f, 0x34,
+  0xb1, 0x69, 0x68, 0x4f, 0x4b, 0xbf, 0x02, 0x59, 0x39, 0x0d, 0x00, 0xf3, 0xff, 0x32, 0xae, 0xfb,
+  0xd6, 0xd0, 0x9e, 0x86, 0xbc, 0x25, 0x8a, 0x0a, 0x96, 0x8b, 0xda, 0xc4, 0xfe, 0xf9, 0x2b, 0x4c,
+  0x9f, 0xa4, 0x10, 0x41, 0x0c, 0xec, 0xec, 0xec, 0xec, 0x86, 0x43, 0x20, 0x82, 0x06, 0x88, 0xe8,
+  0x5c, 0xdf, 0x82, 0xb4, 0xd8, 0xc5, 0xb5, 0xe1, 0xae, 0x6f, 0xcb, 0x79, 0x92, 0x57, 0x19, 0x44,
+  0xae, 0x1e, 0xf4, 0xbf, 0x2d, 0xe1, 0xd0, 0xc4, 0x48, 0xb0, 0xc9, 0x67, 0xa2, 0x58, 0xbb, 0xc2,
+  0xbd, 0x4d, 0x79, 0x4f, 0x0e, 0x8e, 0x99, 0x04, 0x0b, 0x0c, 0xe8, 0xe8, 0xe8, 0x58, 0x5a, 0x9e,
+  0xf4, 0xb5, 0xbb, 0xc3, 0xa1, 0x8a, 0xb0, 0xb8, 0x15, 0x09, 0x08, 0x74, 0x2a, 0xd6, 0xd6, 0xd4,
+  0xb6, 0x3b, 0xc3, 0x20, 0x8c, 0x12, 0xc3, 0x44, 0x10, 0x88, 0x58, 0x74, 0x2a, 0xd9, 0x04, 0x73,
+  0x82, 0x11, 0x0b, 0x73, 0xbd, 0xaf, 0x7b, 0xbc, 0xa4, 0x42, 0xf0, 0x9d, 0xe3, 0xb6, 0x43, 0x20,
+  0x81, 0xa8, 0xe6, 0xef, 0x7b, 0xbc, 0xaf, 0x0d, 0xde, 0x17, 0x0f, 0x78, 0xe8, 0x48, 0xd8, 0xbb,
+  0xc3, 0xbf, 0x09, 0x6b, 0x95, 0xc2, 0x44, 0xf2, 0xef, 0x0b, 0x82, 0xbc, 0x76, 0x20, 0x6b, 0xf4,
+  0x4b, 0x0e, 0xf9, 0xc9, 0x3c, 0x9d, 0x70, 0x58, 0x92, 0x78, 0x49, 0x38, 0x78, 0x57, 0x96, 0xb8,
+  0x7b, 0x1d, 0x09, 0x92, 0xb2, 0xb2, 0x43, 0xc9, 0xde, 0x59, 0x38, 0x75, 0x88, 0xe4, 0xf4, 0x2c,
+  0x3c, 0xa2, 0x06, 0x25, 0x9f, 0x7c, 0x3d, 0x8c, 0x81, 0xe1, 0xd0, 0xab, 0x0d, 0x49, 0x11, 0x82,
+  0x58, 0x77, 0x97, 0x84, 0xbd, 0x8e, 0x85, 0x79, 0x78, 0x4f, 0x0f, 0x94, 0x61, 0xbf, 0x82, 0xac,
+  0x3b, 0x23, 0x2e, 0xc9, 0xc3, 0xac, 0x27, 0x39, 0x56, 0x3e, 0x0f, 0x43, 0xbe, 0x25, 0x43, 0xa1,
+  0x0a, 0xc6, 0xe0, 0xed, 0x90, 0x47, 0x35, 0x43, 0x70, 0x37, 0x39, 0x77, 0x84, 0xf0, 0xf3, 0x43,
+  0x20, 0x4a, 0x32, 0xad, 0x8f, 0x83, 0xbd, 0x1e, 0xf2, 0xeb, 0x1d, 0xb1, 0xb8, 0xeb, 0x0a, 0xb0,
+  0x9f, 0xac, 0x4f, 0x39, 0x25, 0x1d, 0x0b, 0xa2, 0x4b, 0x20, 0x5d, 0x12, 0x4f, 0x29, 0xc4, 0xf0,
+  0x96, 0x4b, 0xd7, 0x39, 0x92, 0xc8, 0x3d, 0x41, 0x02, 0xe8, 0x9c, 0x49, 0x3f, 0xe6, 0xcf, 0xff,
+  0xc4, 0x00, 0x25, 0x10, 0x00, 0x03, 0x00, 0x01, 0x04, 0x02, 0x03, 0x01, 0x00, 0x03, 0x39, 0x02,
+  0x00, 0x38, 0x02, 0xd1, 0x20, 0x40, 0x50, 0x30, 0x60, 0x21, 0x41, 0x51, 0x71, 0x61, 0x70, 0x81,
+  0xa0, 0x3b, 0x02, 0xf0, 0xff, 0xff, 0x68, 0x01, 0x00, 0x01, 0x3f, 0x10, 0xf7, 0x67, 0x9d, 0x62,
+  0x21, 0x3d, 0x7d, 0xe7, 0x65, 0x65, 0xef, 0xaa, 0x3f, 0x81, 0x34, 0xca, 0x91, 0x06, 0x79, 0x90,
+  0x9d, 0xbd, 0x5f, 0xa5, 0x5f, 0xba, 0x55, 0xbd, 0xbe, 0x04, 0xa9, 0x06, 0x18, 0x93, 0x7a, 0x13,
+  0x8f, 0x96, 0xd9, 0x4b, 0xa4, 0x44, 0x44, 0x21, 0x08, 0x4e, 0xb9, 0xbe, 0x84, 0x9b, 0x23, 0x2b,
+  0x90, 0x8d, 0x9f, 0x28, 0x4e, 0xed, 0x69, 0xb1, 0x28, 0xb4, 0x69, 0xb6, 0x2f, 0x8d, 0x1e, 0x7f,
+  0xef, 0x25, 0xbd, 0xf5, 0x95, 0x95, 0x95, 0x95, 0x97, 0xae, 0xc8, 0x58, 0x5a, 0x4f, 0x9d, 0x1e,
+  0x0c, 0xbc, 0x7f, 0x7f, 0xf7, 0x90, 0xf4, 0x44, 0xa4, 0xed, 0xda, 0xbb, 0x96, 0x57, 0x45, 0x76,
+  0x26, 0x52, 0x13, 0xbb, 0x8b, 0xa1, 0xa7, 0xce, 0xea, 0x5e, 0x9e, 0xad, 0x09, 0xf6, 0x4d, 0x88,
+  0xa4, 0x27, 0x56, 0xd8, 0x95, 0x20, 0x6a, 0x68, 0xf9, 0x67, 0xc8, 0x9d, 0xea, 0xe9, 0x76, 0xd2,
+  0x93, 0xaa, 0xf9, 0x6f, 0x56, 0xa8, 0xbf, 0x5a, 0x3c, 0x33, 0x2e, 0x61, 0x56, 0x74, 0x27, 0x7c,
+  0x74, 0xbb, 0x10, 0xd6, 0xca, 0x64, 0x6b, 0xae, 0x6f, 0xa1, 0x3e, 0xf9, 0x2d, 0xf4, 0x25, 0xfa,
+  0x3f, 0xc6, 0x89, 0x21, 0xa8, 0x27, 0x7c, 0x37, 0x64, 0xd5, 0x7c, 0x8d, 0x6d, 0x4c, 0x84, 0xeb,
+  0x1a, 0x77, 0x95, 0x97, 0xff, 0x00, 0x75, 0x79, 0xd7, 0x0f, 0x7d, 0xdc, 0xf5, 0x46, 0x77, 0x52,
+  0x90, 0x84, 0xf4, 0x34, 0xa3, 0xd6, 0x6c, 0x2c, 0x6c, 0x6f, 0x64, 0xd8, 0xb1, 0xb1, 0x0f, 0xc1,
+  0x46, 0xfc, 0x8b, 0xd1, 0x3e, 0xb4, 0x5b, 0x10, 0xf3, 0xb3, 0x3e, 0xb2, 0xb1, 0xa2, 0xc0, 0xf5,
+  0x43, 0xd8, 0x98, 0xfc, 0xaf, 0x80, 0xb9, 0xeb, 0x98, 0xb1, 0xa2, 0x1e, 0xa8, 0x7b, 0x6f, 0x31,
+  0x8b, 0x9d, 0x37, 0xde, 0x1a, 0xd5, 0x63, 0x56, 0xf5, 0x59, 0x1e, 0x38, 0x4b, 0xce, 0xc5, 0xd3,
+  0x2e, 0x2a, 0xc0, 0xf7, 0x3c, 0x74, 0x2c, 0x5d, 0xc3, 0xd5, 0x60, 0x7d, 0x3b, 0x17, 0x39, 0xf2,
+  0x9e, 0xab, 0x1b, 0xd6, 0x38, 0x0b, 0xd2, 0x9b, 0xd5, 0x60, 0x7b, 0x90, 0xf3, 0xe5, 0x7d, 0xfa,
+  0xe0, 0x2c, 0x0f, 0x3b, 0x90, 0xfd, 0x2e, 0x70, 0x56, 0x07, 0x9e, 0x1b, 0xec, 0x1f, 0x40, 0x87,
+  0x9f, 0x63, 0x43, 0xcf, 0x0d, 0x7a, 0x82, 0x1e, 0x7d, 0x3d, 0x71, 0x10, 0xf3, 0xe9, 0x33, 0x6c,
+  0xe2, 0xa1, 0xfb, 0xe5, 0x29, 0x4a, 0x52, 0x94, 0xa5, 0xec, 0x5f, 0x46, 0xbc, 0x10, 0x84, 0x21,
+  0x08, 0x42, 0x13, 0xa2, 0x7d, 0x8b, 0xf4, 0xe5, 0xe9, 0xd3, 0x6a, 0xd6, 0xff, 0x00, 0xa3, 0x6e,
+  0x94, 0xbe, 0x1a, 0x52, 0x94, 0xbb, 0x98, 0xbd, 0x31, 0x89, 0x52, 0x21, 0xe3, 0x48, 0xfc, 0x10,
+  0x40, 0xd2, 0x82, 0xf9, 0x67, 0xf4, 0x47, 0xa2, 0xd5, 0x8b, 0xd3, 0x19, 0x86, 0x8f, 0x0c, 0x59,
+  0x5e, 0x05, 0x95, 0xae, 0x06, 0x5b, 0x0b, 0xd4, 0x18, 0x9c, 0x2a, 0x1b, 0xf8, 0x16, 0x7c, 0x3f,
+  0xc1, 0xfc, 0x0d, 0xd4, 0x27, 0x08, 0x20, 0x6e, 0xfa, 0x8b, 0xd1, 0x1e, 0xcb, 0xba, 0x52, 0x3f,
+  0xc9, 0xfd, 0x0d, 0x41, 0x2a, 0x7f, 0x43, 0x65, 0xea, 0x4c, 0x4f, 0x47, 0x86, 0x64, 0x45, 0xf8,
+  0x45, 0xbb, 0x2d, 0x70, 0x32, 0xd1, 0xe1, 0xfa, 0x93, 0x13, 0xd1, 0xbf, 0xa3, 0x2d, 0x5e, 0x5e,
+  0xd5, 0x92, 0xaf, 0xd2, 0x8d, 0xa8, 0x2f, 0x87, 0xa1, 0xbb, 0xb1, 0x8b, 0xd3, 0x5e, 0xda, 0x2b,
+  0xf0, 0x42, 0x10, 0x84, 0xd8, 0xc5, 0xea, 0x73, 0x80, 0xc5, 0xd1, 0x4f, 0xf7, 0x95, 0x2f, 0xb2,
+  0x4f, 0x6b, 0x7b, 0x19, 0x92, 0x31, 0xa8, 0x64, 0x8f, 0xf0, 0x8d, 0x7a, 0xd3, 0x16, 0xac, 0xc3,
+  0x47, 0x83, 0x2d, 0x1e, 0x3d, 0x79, 0x8b, 0x1a, 0x60, 0x7d, 0xb4, 0x6f, 0xe0, 0x5e, 0xba, 0xca,
+  0xca, 0xf4, 0x8c, 0x8f, 0xf3, 0x45, 0xc2, 0x7d, 0xa2, 0xde, 0xc5, 0xa3, 0x17, 0x91, 0x98, 0x69,
+  0xf4, 0x30, 0xd4, 0xba, 0xd6, 0xbc, 0x5f, 0x13, 0x72, 0x1f, 0x9d, 0x8b, 0x47, 0xa5, 0x29, 0x7c,
+  0x2c, 0x58, 0xd1, 0xfc, 0xb1, 0x63, 0x4c, 0xbc, 0xad, 0x7a, 0x0b, 0x16, 0x8f, 0x48, 0x4d, 0xac,
+  0x5b, 0x56, 0x10, 0xde, 0x90, 0x55, 0xe9, 0xec, 0x5e, 0x26, 0x2d, 0xbf, 0x24, 0xd2, 0x10, 0x9c,
+  0xb9, 0xc7, 0x7c, 0xc6, 0x2e, 0xc2, 0xf6, 0x6f, 0xd9, 0x1f, 0x29, 0x8b, 0xae, 0xa5, 0x13, 0xd9,
+  0x4a, 0x5d, 0xf4, 0xa5, 0x2a, 0x29, 0x7a, 0x25, 0xc4, 0x7c, 0x4b, 0xe1, 0xac, 0xaf, 0x7d, 0x29,
+  0x50, 0xdf, 0x91, 0xbd, 0xd4, 0xa5, 0x29, 0x78, 0xb4, 0xa5, 0x28, 0x99, 0x27, 0x01, 0xf0, 0x04,
+  0x28, 0xb6, 0x5d, 0xb4, 0xa5, 0xe6, 0x52, 0xf9, 0x29, 0x4a, 0x5e, 0xba, 0x95, 0xff, 0x00, 0xe4,
+  0xe7, 0xff, 0xd9,
+};
+const unsigned int FALLBACK_BUNDLE_len = 9043;
@@ -0,0 +1,117 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "fetch_sched.h"
+
+// EWMA with weight 1/2^EWMA_SHIFT for the newest sample
+#define EWMA_SHIFT 2
+// A sample beyond this many times the estimate counts as this many (frame switched off for the night)
+#define MAX_SAMPLE_FACTOR 3
+
+static uint32_t opens;
+static uint32_t last_open;
+static uint32_t last_slide;         // last open that counted as a slide, interval samples are measured from it
+static uint32_t interval;           // 0: not learned yet
+static uint32_t interval_dev;
+static uint32_t download;           // 0: nothing measured yet
+static uint32_t download_dev;
+static uint32_t predictions;
+static int32_t last_error;
+static uint64_t abs_error_sum;
+
+
+// Move estimate and its mean deviation towards sample
+static void ewma(uint32_t * estimate, uint32_t * dev, uint32_t sample)
+{
+    if (*estimate == 0)
+    {
+        *estimate = sample;
+        *dev = sample / 2;
+        return;
+    }
+    if (sample > MAX_SAMPLE_FACTOR * *estimate)
+    {
+        sample = MAX_SAMPLE_FACTOR * *estimate;
+    }
+    const int32_t err = (int32_t)(sample - *estimate);
+    const int32_t abs_err = (err < 0) ? -err : err;
+    *dev = (uint32_t)((int32_t)*dev + ((abs_err - (int32_t)*dev) / (1 << EWMA_SHIFT)));
+    *estimate = (uint32_t)((int32_t)*estimate + (err / (1 << EWMA_SHIFT)));
+}
+
+
+void fetch_sched_opened(uint32_t now)
+{
+    const uint32_t sample = now - last_slide;
+    if (opens == 0)
+    {
+        last_slide = now;
+    }
+    // Closer opens are the host browsing: no interval sample, no prediction to score, the next slide
+    // is measured from the one before
+    else if (sample >= FETCH_SCHED_MIN_INTERVAL_MS)
+    {
+        if (interval > 0)
+        {
+            // How far off the prediction made at the last slide was
+            last_error = (int32_t)(sample - interval);
+            abs_error_sum += (last_error < 0) ? -(int64_t)last_error : last_error;
+            predictions++;
+        }
+        ewma(&interval, &interval_dev, sample);
+        last_slide = now;
+    }
+    last_open = now;
+    opens++;
+}
+
+
+void fetch_sched_downloaded(uint32_t ms)
+{
+    ewma(&download, &download_dev, (ms > 0) ? ms : 1);
+}
+
+
+uint32_t fetch_sched_wait(uint32_t now, uint32_t ahead)
+{
+    const uint32_t since = now - last_open;
+    if ((interval == 0) || (download == 0))
+    {
+        return (since < FETCH_SCHED_DELAY_MS) ? (FETCH_SCHED_DELAY_MS - since) : 0;
+    }
+    // Predicted open of the slot, less the download with its margin
+    const uint32_t open_in = ahead * interval;
+    const uint32_t lead = download + 4 * download_dev + 2 * interval_dev + FETCH_SCHED_GUARD_MS;
+    if (open_in <= lead)
+    {
+        return 0;
+    }
+    const uint32_t start = open_in - lead;
+    return (since < start) ? (start - since) : 0;
+}
+
+
+void fetch_sched_stats(struct fetch_sched_stats * stats)
+{
+    stats->opens = opens;
+    stats->interval_ms = interval;
+    stats->interval_dev_ms = interval_dev;
+    stats->download_ms = download;
+    stats->download_dev_ms = download_dev;
+    stats->predictions = predictions;
+    stats->last_error_ms = last_error;
+    stats->mean_abs_error_ms = predictions ? (uint32_t)(abs_error_sum / predictions) : 0;
+}
+
+
+void fetch_sched_reset(void)
+{
+    opens = 0;
+    interval = 0;
+    interval_dev = 0;
+    download = 0;
+    download_dev = 0;
+    predictions = 0;
+    last_error = 0;
+    abs_error_sum = 0;
+}
@@ -1,62 +1,934 @@
 #include "http_client.h"
 #include "credentials.h"
+#include "storage.h"
+#include "image_cache.h"
+#include "fallback.h"
+#include "fetch_sched.h"
+#include "usb_msc.h"
+#include "led_status.h"
 #include <Arduino.h>
 #include <WiFiClient.h>
 #include <HTTPClient.h>
+#include <lwip/sockets.h>
 
-extern "C" {
-    extern unsigned char FILE_IMG_JPG[];    // defined in storage.c
-    extern unsigned int  FILE_IMG_JPG_len;  // actual fetched size, read by storage.c
+// No downloads right after boot: WiFi is still connecting, and a failed download would replace the
+// cached images just restored. Image opens meanwhile are learned and scheduled from then on
+#define HTTP_BOOT_DELAY_MS 10000
+// Pause before retrying after a failed download, the ring keeps serving what it has meanwhile
+#define HTTP_RETRY_DELAY_MS 2000
+// A body that stops arriving for HTTP_STALL_MS counts as broken off. Broken off downloads are resumed
+// where they stopped (Range), every HTTP_RESUME_DELAY_MS, until HTTP_RESUME_BUDGET_MS after the request
+#define HTTP_STALL_MS           5000
+#define HTTP_RESUME_DELAY_MS    500
+#define HTTP_RESUME_BUDGET_MS   20000
+// Keep the connection to the image server open between downloads (HTTP/1.1 keep-alive): no DNS lookup,
+// TCP handshake and slow start per image. 0: a new connection per download
+#ifndef HTTP_KEEP_ALIVE
+#define HTTP_KEEP_ALIVE 1
+#endif
+// Fetch task: stack in bytes (HTTPClient and WiFiClient live on it, buffers don't), priority as loop(),
+// core 0 next to the WiFi stack (Arduino runs loop() on core 1). It looks for host events every
+// HTTP_TASK_POLL_MS, commands wake it up right away
+#define HTTP_TASK_STACK     8192
+#define HTTP_TASK_PRIORITY  1
+#define HTTP_TASK_CORE      0
+#define HTTP_TASK_POLL_MS   10
+#define HTTP_QUEUE_LEN      8
+// Stream every image through the mapped flash cache, the host can start reading it after the first sector.
+// 0: only images too big for the RAM buffers, the rest is published once complete
+#ifndef HTTP_STREAM_THROUGH
+#define HTTP_STREAM_THROUGH 0
+#endif
+// Every request tells the server the biggest image the device takes (X-Max-Bytes) and the frame's
+// resolution (X-Frame-Size: what "set resolution" stored, else HTTP_FRAME_SIZE), so it can send a variant that fits
+#ifndef HTTP_FRAME_SIZE
+#define HTTP_FRAME_SIZE "800x600"
+#endif
+
+static bool     prefetch_pending = false;
+static uint32_t retry_at = 0;
+static int32_t  opened_slot = -1;   // slot the host opened last
+static uint32_t event_counts[STORAGE_EV_TYPES];
+static uint32_t t_published;        // when the last download was published
+static uint32_t published_bytes;    // and its size
+static bool     paused = false;
+
+static QueueHandle_t command_queue;
+static QueueHandle_t result_queue;
+static TaskHandle_t  fetch_task_handle;
+static uint32_t      commands;
+static uint32_t      results_dropped;
+
+// Fetched images are kept in the flash cache, it stands in while the server is slow or unreachable
+static struct cache_flash cache_flash;
+static bool     cache_ok = false;
+static uint32_t cache_next = 0;     // position in the cache's LRU list to serve next
+static uint64_t slot_mapped[STORAGE_IMG_SLOTS];     // cached image a slot serves from mapped flash, 0: RAM
+
+// Without network and cached images the compiled-in fallbacks take turns, boot showed the first ones
+static uint32_t fallback_next = STORAGE_IMG_SLOTS;
+
+// Downloads pass through here on their way into a slot or the cache
+static uint8_t chunk[IMAGE_CACHE_SECTOR];
+
+// Connection to the image server, lives across downloads. HTTPClient closes its client when destroyed
+static WiFiClient conn;
+static HTTPClient http;
+
+// Setup: from the request until the response headers are in, i.e. DNS, connect and first byte
+static struct
+{
+    uint32_t requests;
+    uint32_t reused;        // sent on a connection kept from the download before
+    uint32_t closed;        // kept connection the server had closed meanwhile, reconnected
+    uint32_t stale;         // kept connection that failed the request, sent again on a new one
+    uint32_t setup_new_sum, setup_new_max;
+    uint32_t setup_reused_sum, setup_reused_max;
+    uint32_t setup_last;
+} conn_stats;
+static bool conn_kept;      // connection left open after the last download
+
+static struct
+{
+    uint32_t drops;         // body broke off, resume tried
+    uint32_t resumed;       // continued with 206
+    uint32_t failed;        // gave up, or the image changed meanwhile
+    uint32_t bytes_kept;    // received before a drop and not fetched again
+} resume_stats;
+
+// Body receive path: socket reads, and sleeps in select() waiting for data
+static struct
+{
+    uint32_t reads;
+    uint32_t waits;
+    uint32_t bytes;
+} rx_stats;
+
+// Validators of the server image each slot holds, sent along with the next download into the slot
+// (conditional GET): a server that still has that image answers 304 and the slot stays as it is.
+// Empty: the slot holds something else (cached, fallback, failed download)
+#define HTTP_ETAG_LEN 64
+static char     slot_etag[STORAGE_IMG_SLOTS][HTTP_ETAG_LEN];
+static char     slot_modified[STORAGE_IMG_SLOTS][32];     // Last-Modified, an HTTP date
+static uint64_t slot_hash[STORAGE_IMG_SLOTS];             // image_cache_hash of that image, 0: unknown
+
+static struct
+{
+    uint32_t conditional;   // requests with If-None-Match or If-Modified-Since
+    uint32_t not_modified;  // 304: image in the slot is still the newest
+    uint32_t same_etag;     // 200 with the ETag the slot has, body skipped
+    uint32_t same_content;  // downloaded, same bytes as the slot has, not published
+    uint32_t bytes_saved;   // not downloaded (304, same ETag) or not published again (same content)
+} cond_stats;
+
+// Responses bigger than X-Max-Bytes, refused on their Content-Length before the body
+static struct
+{
+    uint32_t refused;
+    uint32_t bytes_avoided;
+    uint32_t last;          // Content-Length of the last one
+} oversize_stats;
+
+
+// Complete JPEG: starts with SOI, ends with EOI (some encoders pad a few bytes behind it)
+static bool jpeg_complete(const unsigned char *data, size_t len)
+{
+    if ((len < 4) || (data[0] != 0xFF) || (data[1] != 0xD8))
+    {
+        return false;
+    }
+    for (size_t i = len - 1; (i > 0) && (i + 16 >= len); i--)
+    {
+        if ((data[i - 1] == 0xFF) && (data[i] == 0xD9))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
-volatile uint32_t http_fetch_trigger = 0;
+// First 2 and last 16 bytes of a download, all jpeg_complete() looks at. The image itself may be packed
+struct jpeg_ends
+{
+    unsigned char bytes[2 + 16];
+    size_t len;     // bytes in bytes[]
+    size_t seen;    // bytes of the download so far
+};
 
-void http_client_process(void)
+static void jpeg_ends_add(struct jpeg_ends *ends, const unsigned char *data, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        if ((ends->seen + i >= 2) && (n - i > 16))
+        {
+            continue;   // neither head nor tail
+        }
+        if (ends->len == sizeof(ends->bytes))
+        {
+            memmove(&ends->bytes[2], &ends->bytes[3], sizeof(ends->bytes) - 3);
+            ends->len--;
+        }
+        ends->bytes[ends->len++] = data[i];
+    }
+    ends->seen += n;
+}
+
+static void validators_clear(uint32_t slot)
+{
+    slot_etag[slot][0] = '\0';
+    slot_modified[slot][0] = '\0';
+    slot_hash[slot] = 0;
+}
+
+// Validators of the response, for the image just put into slot
+static void validators_set(uint32_t slot, uint64_t hash)
+{
+    const String etag = http.header("ETag");
+    const String modified = http.header("Last-Modified");
+    validators_clear(slot);
+    if ((etag.length() > 0) && (etag.length() < HTTP_ETAG_LEN))
+    {
+        strcpy(slot_etag[slot], etag.c_str());
+    }
+    if ((modified.length() > 0) && (modified.length() < sizeof(slot_modified[slot])))
+    {
+        strcpy(slot_modified[slot], modified.c_str());
+    }
+    slot_hash[slot] = hash;
+}
+
+// Slot got published anew, let the log erase the image it mapped before
+static void slot_unmap(uint32_t slot)
 {
-    if ((http_fetch_trigger >= 10000) && ((millis() - http_fetch_trigger) > 2500)) //2.5 second after last access (not before 10s after startup)
+    if (slot_mapped[slot] != 0)
     {
-        http_fetch_trigger = 0;
+        image_cache_pin(slot_mapped[slot], false);
+        slot_mapped[slot] = 0;
+    }
+}
 
-        char url[256];
-        creds_get_url(url, sizeof(url));
-        if (url[0] == '\0')
+// Serve cached image hash from slot straight out of the mapped partition
+static bool slot_map(uint32_t slot, uint64_t hash)
+{
+    const void *data;
+    const uint32_t len = image_cache_map(hash, &data);
+    if ((len == 0) || (len > STORAGE_IMG_FILE_SIZE))
+    {
+        return false;
+    }
+    image_cache_pin(hash, true);
+    storage_image_publish_mapped(slot, data, len);     // returns once the previous image is no longer read
+    slot_unmap(slot);
+    slot_mapped[slot] = hash;
+    return true;
+}
+
+// Fill slot with a cached image, mapped if possible, copied otherwise. Using one moves it to the front
+// of the LRU list, so stepping through the list position by position cycles through all cached images
+static bool cache_fill(uint32_t slot)
+{
+    static uint64_t hashes[IMAGE_CACHE_MAX_ENTRIES];
+    const uint32_t n = cache_ok ? image_cache_list(hashes, IMAGE_CACHE_MAX_ENTRIES) : 0;
+    if (n == 0)
+    {
+        return false;
+    }
+    const uint64_t hash = hashes[cache_next++ % n];
+    validators_clear(slot);
+    if (slot_map(slot, hash))
+    {
+        return true;
+    }
+#if STORAGE_IMG_PACKED
+    return false;   // packing takes the image in pieces, image_cache_read() hands it out whole
+#else
+    struct image_buf *buf = storage_image_acquire(slot, 0);
+    const uint32_t len = image_cache_read(hash, buf->data, buf->size);
+    if (len == 0)
+    {
+        storage_image_abort(slot, buf);
+        return false;
+    }
+    storage_image_publish(slot, buf, len);
+    slot_unmap(slot);
+    return true;
+#endif
+}
+
+// Keep the image just published in buf in the flash cache
+static void cache_put(const struct image_buf *buf)
+{
+#if STORAGE_IMG_PACKED
+    // Unpacked block by block into a streamed put
+    uint64_t hash;
+    bool ok = (image_cache_begin(buf->len) == 0);
+    for (uint32_t block = 0; ok && (block * STORAGE_IMG_BLOCK < buf->len); block++)
+    {
+        const uint32_t n = storage_image_read_block(buf, block, chunk);
+        ok = (n > 0) && (image_cache_write(chunk, n) == 0);
+    }
+    if (!ok || (image_cache_commit(&hash) != 0))
+    {
+        image_cache_cancel();
+        Serial.println("Cache: write failed");
+    }
+#else
+    if (image_cache_put(buf->data, buf->len) != 0)
+    {
+        Serial.println("Cache: write failed");
+    }
+#endif
+}
+
+// Fill slot with the next compiled-in fallback image
+static bool fallback_fill(uint32_t slot)
+{
+    const uint32_t n = fallback_count();
+    if ((n == 0) || !storage_image_fallback(slot, fallback_next++ % n))
+    {
+        return false;
+    }
+    validators_clear(slot);
+    slot_unmap(slot);
+    return true;
+}
+
+// Most recent images instead of the compiled-in fallback, right from the start
+static void cache_restore(void)
+{
+    cache_ok = (image_cache_partition(&cache_flash, "imgcache") == 0) && (image_cache_mount(&cache_flash) >= 0);
+    if (!cache_ok)
+    {
+        Serial.println("Cache: no image cache partition");
+        return;
+    }
+    uint32_t slot = 0;
+    while ((slot < STORAGE_IMG_SLOTS) && cache_fill(slot))
+    {
+        slot++;
+    }
+    struct image_cache_stats st;
+    image_cache_stats(&st);
+    Serial.printf("Cache: %u images (%u kB), %u restored\n", st.entries, st.bytes / 1024, slot);
+}
+
+#if HTTP_FETCH_TASK
+static void fetch_task(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        http_client_process();
+        // Sleeps until a command comes in or it's time to look at the host events again
+        uint32_t cmd;
+        xQueuePeek(command_queue, &cmd, pdMS_TO_TICKS(HTTP_TASK_POLL_MS));
+    }
+}
+#endif
+
+void http_client_begin(void)
+{
+    Serial.printf("Fallback: %u images, %u kB of flash\n", fallback_count(), fallback_bundle_size() / 1024);
+    cache_restore();
+
+    command_queue = xQueueCreate(HTTP_QUEUE_LEN, sizeof(uint32_t));
+    result_queue = xQueueCreate(HTTP_QUEUE_LEN, sizeof(struct http_result));
+#if HTTP_FETCH_TASK
+    xTaskCreatePinnedToCore(fetch_task, "fetch", HTTP_TASK_STACK, NULL, HTTP_TASK_PRIORITY, &fetch_task_handle, HTTP_TASK_CORE);
+#endif
+}
+
+bool http_client_command(enum http_command cmd)
+{
+    const uint32_t c = cmd;
+    return xQueueSend(command_queue, &c, 0) == pdTRUE;
+}
+
+bool http_client_result(struct http_result *result)
+{
+    return xQueueReceive(result_queue, result, 0) == pdTRUE;
+}
+
+static void post_result(uint32_t slot, enum http_source source, uint32_t bytes, uint32_t ms)
+{
+    const struct http_result r = { slot, (uint32_t)source, bytes, ms };
+    if (xQueueSend(result_queue, &r, 0) != pdTRUE)
+    {
+        results_dropped++;  // nobody picks them up
+    }
+}
+
+void http_client_task_status(char *buf, size_t len)
+{
+    if (fetch_task_handle == NULL)
+    {
+        snprintf(buf, len, "fetch pipeline in loop(), %u commands, %s", commands, paused ? "paused" : "running");
+        return;
+    }
+    snprintf(buf, len, "fetch task on core %d, %u of %u bytes stack never used, %u commands, %u results dropped, %s",
+             HTTP_TASK_CORE, (unsigned)uxTaskGetStackHighWaterMark(fetch_task_handle), HTTP_TASK_STACK,
+             commands, results_dropped, paused ? "paused" : "running");
+}
+
+void http_client_cache_status(char *buf, size_t len)
+{
+    struct image_cache_stats st;
+    image_cache_stats(&st);
+    snprintf(buf, len, "%s%s, %u images, %u of %u kB, %u written, %u dedup, %u read, %u mapped, %u moved, %u evicted, %u sectors erased",
+             cache_ok ? "mounted" : "not mounted", (cache_ok && cache_flash.map) ? " and mapped" : "",
+             st.entries, st.bytes / 1024, st.size / 1024,
+             st.puts, st.dedups, st.reads, st.maps, st.moves, st.evictions, st.erases);
+}
+
+// Biggest image a slot takes: the RAM buffer, or the image file if the flash cache is there to stream it through.
+// Packed slots may hold a bigger image, that only shows once it's in
+static uint32_t http_max_bytes(void)
+{
+    return (STORAGE_IMG_PACKED || (cache_ok && cache_flash.map)) ? STORAGE_IMG_FILE_SIZE : STORAGE_IMG_SIZE;
+}
+
+// GET url, on the kept connection if the server left it open. A kept connection that turns out dead
+// (reset, or closed while the request was on its way) gets the request once more on a new one.
+// from 0: the whole image, conditional on the validators of slot. Otherwise the image from byte from on,
+// if it still is the one if_range names
+static int http_get(const char *url, uint32_t slot, uint32_t from, const char *if_range)
+{
+    static const char *HEADERS[] = { "ETag", "Last-Modified", "Content-Range" };
+    if (conn_kept && !conn.connected())
+    {
+        conn_stats.closed++;    // server closed it (idle timeout), HTTPClient connects anew
+    }
+    for (bool retry = false; ; retry = true)
+    {
+        const bool reused = conn.connected();
+        http.begin(conn, url);
+        http.setReuse(HTTP_KEEP_ALIVE);
+        http.collectHeaders(HEADERS, sizeof(HEADERS) / sizeof(HEADERS[0]));
+        char max_bytes[16];
+        char frame[16];
+        snprintf(max_bytes, sizeof(max_bytes), "%u", http_max_bytes());
+        creds_get_resolution(frame, sizeof(frame));
+        http.addHeader("X-Max-Bytes", max_bytes);
+        http.addHeader("X-Frame-Size", (frame[0] != '\0') ? frame : HTTP_FRAME_SIZE);
+        if (from > 0)
+        {
+            char range[32];
+            snprintf(range, sizeof(range), "bytes=%u-", from);
+            http.addHeader("Range", range);
+            http.addHeader("If-Range", if_range);
+        }
+        else
         {
-            Serial.println("HTTP: no URL configured");
-            FILE_IMG_JPG_len = 0;
-            return;
+            if (slot_etag[slot][0] != '\0')
+            {
+                http.addHeader("If-None-Match", slot_etag[slot]);
+            }
+            if (slot_modified[slot][0] != '\0')
+            {
+                http.addHeader("If-Modified-Since", slot_modified[slot]);
+            }
         }
+        const uint32_t t0 = millis();
+        const int code = http.GET();
+        const uint32_t setup = millis() - t0;
+        if ((code < 0) && reused && !retry)
+        {
+            conn_stats.stale++;
+            http.end();
+            conn.stop();
+            continue;
+        }
+        conn_stats.requests++;
+        conn_stats.setup_last = setup;
+        if (reused)
+        {
+            conn_stats.reused++;
+            conn_stats.setup_reused_sum += setup;
+            conn_stats.setup_reused_max = max(conn_stats.setup_reused_max, setup);
+        }
+        else
+        {
+            conn_stats.setup_new_sum += setup;
+            conn_stats.setup_new_max = max(conn_stats.setup_new_max, setup);
+        }
+        return code;
+    }
+}
 
-        Serial.printf("HTTP: fetching %s\n", url);
+// Done with the response. Only a response read to its end leaves the connection usable for the next one
+static void http_done(bool body_read)
+{
+    http.end();     // keeps the connection if setReuse and the server agreed (no "Connection: close")
+    if (!body_read)
+    {
+        conn.stop();
+    }
+    conn_kept = conn.connected();
+}
 
-        HTTPClient http;
-        http.begin(url);
-        int code = http.GET();
+// Body of the image being downloaded, what it takes to resume it after the connection broke off
+struct http_body
+{
+    const char *url;
+    uint32_t size;                  // Content-Length, 0: unknown, the body ends with the connection
+    uint32_t received;              // bytes of the body so far
+    uint32_t t_request;
+    char validator[HTTP_ETAG_LEN];  // strong ETag or Last-Modified, for If-Range. Empty: can't resume
+};
+
+static void http_body_begin(struct http_body *body, const char *url, int size, uint32_t t_request)
+{
+    body->url = url;
+    body->size = (size > 0) ? size : 0;
+    body->received = 0;
+    body->t_request = t_request;
+    body->validator[0] = '\0';
+    const String etag = http.header("ETag");
+    const String modified = http.header("Last-Modified");
+    const String &v = ((etag.length() > 0) && (strncmp(etag.c_str(), "W/", 2) != 0)) ? etag : modified;
+    if (v.length() < sizeof(body->validator))
+    {
+        strcpy(body->validator, v.c_str());
+    }
+}
+
+// Connection broke off after body->received bytes: ask for the rest of that very image (Range, If-Range),
+// on a new connection, until HTTP_RESUME_BUDGET_MS after the first request.
+// false: can't resume, gave up, or the server has another image by now
+static bool http_resume(struct http_body *body)
+{
+    if ((body->size == 0) || (body->validator[0] == '\0'))
+    {
+        return false;
+    }
+    resume_stats.drops++;
+    for (uint32_t attempt = 0; millis() - body->t_request < HTTP_RESUME_BUDGET_MS; attempt++)
+    {
+        http.end();
+        conn.stop();
+        if (attempt > 0)
+        {
+            delay(HTTP_RESUME_DELAY_MS);    // WiFi may be reconnecting
+        }
+        const int code = http_get(body->url, 0, body->received, body->validator);
+        if (code < 0)
+        {
+            continue;   // no connection (yet)
+        }
+        unsigned first, last, total;
+        if ((code == HTTP_CODE_PARTIAL_CONTENT)
+         && (sscanf(http.header("Content-Range").c_str(), "bytes %u-%u/%u", &first, &last, &total) == 3)
+         && (first == body->received) && (total == body->size))
+        {
+            resume_stats.resumed++;
+            resume_stats.bytes_kept += body->received;
+            Serial.printf("HTTP: resumed at %u of %u bytes\n", body->received, body->size);
+            return true;
+        }
+        break;          // 200: the image changed meanwhile (If-Range), or a server without ranges
+    }
+    resume_stats.failed++;
+    Serial.printf("HTTP: could not resume at %u of %u bytes\n", body->received, body->size);
+    return false;
+}
+
+// Sleep until the connection has data or closes, at most ms: lwIP select() wakes the task as the segment
+// arrives instead of on the next tick. false: timed out
+static bool http_wait(uint32_t ms)
+{
+    const int fd = conn.fd();
+    if (fd < 0)
+    {
+        return false;
+    }
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(fd, &readable);
+    struct timeval timeout = { (time_t)(ms / 1000), (suseconds_t)((ms % 1000) * 1000) };
+    rx_stats.waits++;
+    return select(fd + 1, &readable, NULL, NULL, &timeout) > 0;
+}
+
+// Fill dst with max bytes of the body, fewer only at its end. Sleeps on the socket while nothing is buffered,
+// resumes the download if the connection breaks off or stalls.
+// Returns 0 at the end of the body, or once the connection is gone for good
+static size_t http_read(struct http_body *body, uint8_t *dst, size_t max)
+{
+    size_t got = 0;
+    while (got < max)
+    {
+        WiFiClient *stream = http.getStreamPtr();
+        if (stream->available() > 0)
+        {
+            const int n = stream->read(dst + got, max - got);
+            if (n > 0)
+            {
+                got += n;
+                body->received += n;
+                rx_stats.reads++;
+                continue;
+            }
+        }
+        if (http.connected() && http_wait(HTTP_STALL_MS))
+        {
+            continue;   // data, or the connection closed
+        }
+        if (got > 0)
+        {
+            break;      // hand over what came, the next call resumes
+        }
+        const bool stalled = http.connected();
+        if (((body->size == 0) && !stalled) || (body->received >= body->size) || !http_resume(body))
+        {
+            return 0;
+        }
+    }
+    rx_stats.bytes += got;
+    return got;
+}
+
+// Stream an image into the flash cache and serve it from the mapping while it arrives (stream-through):
+// the host can read every sector as soon as it is in flash, RAM holds just the chunk being written
+static bool http_fetch_to_cache(uint32_t slot, struct http_body *body)
+{
+    const uint32_t size = body->size;
+    storage_image_fetching(slot);
+    if (image_cache_begin(size) != 0)
+    {
+        storage_image_abort(slot, NULL);
+        Serial.println("Cache: no room for the image");
+        return false;
+    }
+    storage_image_stream(slot, image_cache_pending(), size);
+    slot_unmap(slot);
+
+    uint32_t written = 0;
+    uint32_t t_first = 0;
+    while (written < size)
+    {
+        const size_t n = http_read(body, chunk, min(sizeof(chunk), (size_t)(size - written)));
+        if ((n == 0) || (image_cache_write(chunk, n) != 0))
+        {
+            break;
+        }
+        written += n;
+        storage_image_stream_progress(slot, written);
+        led_status_fetch(written, size);
+        if ((t_first == 0) && (written >= DISK_SECTOR_SIZE))
+        {
+            t_first = millis();
+        }
+    }
+
+    uint64_t hash;
+    const unsigned char *data = (const unsigned char *)image_cache_pending();
+    if ((written != size) || (data == NULL) || !jpeg_complete(data, size)
+     || (image_cache_commit(&hash) != 0) || !slot_map(slot, hash))
+    {
+        storage_image_publish_mapped(slot, NULL, 0);    // the host may have read part of it, serve nothing
+        image_cache_cancel();
+        Serial.printf("HTTP: discarded image, %u of %u bytes streamed to flash\n", written, size);
+        return false;
+    }
+    t_published = millis();
+    published_bytes = size;
+    Serial.printf("HTTP: streamed %u bytes into flash, first sector readable after %u ms, complete after %u ms\n",
+                  size, t_first - body->t_request, millis() - body->t_request);
+    return true;
+}
+
+void http_client_conn_status(char *buf, size_t len)
+{
+    const uint32_t created = conn_stats.requests - conn_stats.reused;
+    snprintf(buf, len, "keep-alive %s, %u requests, %u on a kept connection (%u%%), %u new, %u reconnects after the server closed it, "
+             "%u retried; setup new avg %u ms max %u ms, reused avg %u ms max %u ms, last %u ms, %s",
+             HTTP_KEEP_ALIVE ? "on" : "off", conn_stats.requests, conn_stats.reused,
+             conn_stats.requests ? (100 * conn_stats.reused / conn_stats.requests) : 0, created,
+             conn_stats.closed, conn_stats.stale,
+             created ? (conn_stats.setup_new_sum / created) : 0, conn_stats.setup_new_max,
+             conn_stats.reused ? (conn_stats.setup_reused_sum / conn_stats.reused) : 0, conn_stats.setup_reused_max,
+             conn_stats.setup_last, conn_kept ? "connected" : "not connected");
+    const size_t used = strlen(buf);
+    snprintf(buf + used, len - used, "; %u broke off, %u resumed (%u kB not fetched again), %u not resumed; "
+             "%u kB received in %u reads (avg %u bytes), %u waits",
+             resume_stats.drops, resume_stats.resumed, resume_stats.bytes_kept / 1024, resume_stats.failed,
+             rx_stats.bytes / 1024, rx_stats.reads, rx_stats.reads ? (rx_stats.bytes / rx_stats.reads) : 0, rx_stats.waits);
+}
+
+void http_client_cond_status(char *buf, size_t len)
+{
+    uint32_t held = 0;
+    for (uint32_t i = 0; i < STORAGE_IMG_SLOTS; i++)
+    {
+        held += (slot_etag[i][0] != '\0') || (slot_modified[i][0] != '\0');
+    }
+    snprintf(buf, len, "%u of %u slots with validators, %u conditional requests, %u not modified, %u same ETag, "
+             "%u same content; %u fetches avoided, %u kB saved; max %u bytes, %u too big refused (%u kB not downloaded, last %u bytes)",
+             held, STORAGE_IMG_SLOTS, cond_stats.conditional, cond_stats.not_modified, cond_stats.same_etag,
+             cond_stats.same_content, cond_stats.not_modified + cond_stats.same_etag + cond_stats.same_content,
+             cond_stats.bytes_saved / 1024, http_max_bytes(), oversize_stats.refused, oversize_stats.bytes_avoided / 1024,
+             oversize_stats.last);
+}
+
+// Server still has the image slot holds: leave it as it is, ready to be shown again
+static enum http_source slot_unchanged(uint32_t slot, uint32_t *counter, uint32_t saved)
+{
+    (*counter)++;
+    cond_stats.bytes_saved += saved;
+    storage_ring_keep(slot);
+    if (storage_image_front(slot)->len == 0)
+    {
+        validators_clear(slot);     // nothing to keep after all, the next request fetches the image
+    }
+    return HTTP_UNCHANGED;
+}
+
+// Download one image into slot. Returns HTTP_FROM_SERVER if it was published, HTTP_UNCHANGED if the slot
+// holds that image already, HTTP_OVERSIZE if the image was too big and the slot keeps its own,
+// HTTP_FROM_NONE if the download failed
+static enum http_source http_fetch(uint32_t slot)
+{
+    char url[256];
+    creds_get_url(url, sizeof(url));
+    if (url[0] == '\0')
+    {
+        Serial.println("HTTP: no URL configured");
+        prefetch_pending = false;   // until the host opens the next image
+        return HTTP_FROM_NONE;
+    }
+
+    Serial.printf("HTTP: fetching %s into IMG%u.JPG\n", url, slot + 1);
+
+    led_status_fetch(0, 0);
+    const uint32_t t_request = millis();
+    const bool conditional = (slot_etag[slot][0] != '\0') || (slot_modified[slot][0] != '\0');
+    cond_stats.conditional += conditional;
+    const int code = http_get(url, slot, 0, NULL);
+    bool published = false;
+
+    const int size = http.getSize();   // -1 if the server sent no Content-Length
+
+    if (conditional && (code == HTTP_CODE_NOT_MODIFIED))
+    {
+        Serial.printf("HTTP: not modified, IMG%u.JPG stays\n", slot + 1);
+        http_done(true);
+        led_status_fetch_end(true);
+        return slot_unchanged(slot, &cond_stats.not_modified, storage_image_front(slot)->len);
+    }
+    // Server that ignores If-None-Match, but sends the ETag the slot has (strong ones only say the bytes are the same)
+    if ((code == HTTP_CODE_OK) && (slot_etag[slot][0] != '\0') && (strncmp(slot_etag[slot], "W/", 2) != 0)
+     && (strcmp(http.header("ETag").c_str(), slot_etag[slot]) == 0))
+    {
+        Serial.printf("HTTP: same ETag, IMG%u.JPG stays\n", slot + 1);
+        http_done(false);
+        led_status_fetch_end(true);
+        return slot_unchanged(slot, &cond_stats.same_etag, (size > 0) ? size : 0);
+    }
+    // Server that ignores X-Max-Bytes: the image can't be stored, don't spend airtime on it. The slot keeps its
+    // image and counts as ready, the ring moves on to the next one: asking again would only get the same answer
+    if ((code == HTTP_CODE_OK) && (size > 0) && ((uint32_t)size > http_max_bytes()))
+    {
+        Serial.printf("HTTP: image of %d bytes, IMG%u.JPG takes %u, not downloaded\n", size, slot + 1, http_max_bytes());
+        oversize_stats.refused++;
+        oversize_stats.bytes_avoided += size;
+        oversize_stats.last = size;
+        http_done(false);
+        led_status_fetch_end(false);
+        storage_ring_keep(slot);
+        // Nothing to keep: filled from the cache or the fallbacks like after a failed download
+        return (storage_image_front(slot)->len > 0) ? HTTP_OVERSIZE : HTTP_FROM_NONE;
+    }
+    const uint64_t held_hash = slot_hash[slot];
+    struct http_body body;
+    if (code == HTTP_CODE_OK)
+    {
+        validators_clear(slot);     // until the new image is in
+        http_body_begin(&body, url, size, t_request);
+    }
 
-        if (code == HTTP_CODE_OK)
+    if ((code == HTTP_CODE_OK) && (size > 0) && (size <= STORAGE_IMG_FILE_SIZE) && cache_ok && cache_flash.map
+     && (HTTP_STREAM_THROUGH || (size > STORAGE_IMG_SIZE)))
+    {
+        published = http_fetch_to_cache(slot, &body);
+        if (published)
         {
-            WiFiClient *stream = http.getStreamPtr();
-            const size_t capacity = 128 * 1024; //sizeof(FILE_IMG_JPG)
-            size_t written = 0;
+            validators_set(slot, slot_mapped[slot]);
+        }
+    }
+    else if (code == HTTP_CODE_OK)
+    {
+        struct image_buf *buf = storage_image_acquire(slot, (size > 0) ? size : 0);
+        struct jpeg_ends ends = {};
+        size_t written = 0;
+        bool full = false;
 
-            while ((http.connected() || stream->available()) && written < capacity)
+        while (!full && ((size < 0) || (written < (size_t)size)))
+        {
+            const size_t max = (size < 0) ? sizeof(chunk) : min(sizeof(chunk), (size_t)size - written);
+#if STORAGE_IMG_PACKED
+            uint8_t *dst = chunk;
+#else
+            // Straight into the slot, no copy. Past the end of the buffer into chunk: the image doesn't fit
+            uint8_t *dst = (written < buf->size) ? &buf->data[written] : chunk;
+#endif
+            const size_t n = http_read(&body, dst, (dst == chunk) ? max : min(max, (size_t)(buf->size - written)));
+            if (n == 0)
             {
-                size_t avail = stream->available();
-                if (avail == 0) { delay(1); continue; }
-                written += stream->readBytes(FILE_IMG_JPG + written, min(avail, capacity - written));
+                break;
             }
+#if STORAGE_IMG_PACKED
+            full = (storage_image_append(buf, chunk, n) != 0);
+#else
+            full = (dst == chunk);
+#endif
+            jpeg_ends_add(&ends, dst, n);
+            written += n;
+            led_status_fetch(written, (size > 0) ? size : 0);
+        }
 
-            if (written < capacity)
+        // Publish only complete images, a failed download leaves the slot with the previous one
+        // (unless it had to be refilled in place)
+        const bool complete = !full && ((size < 0) || (written == (size_t)size)) && jpeg_complete(ends.bytes, ends.len);
+        uint64_t hash = 0;
+#if !STORAGE_IMG_PACKED
+        hash = complete ? image_cache_hash(buf->data, written) : 0;
+#endif
+        if (complete && (hash != 0) && (hash == held_hash) && (buf != storage_image_front(slot)))
+        {
+            // Same bytes as the slot has: publishing them would only make the host see a change
+            storage_image_abort(slot, buf);
+            validators_set(slot, hash);
+            Serial.printf("HTTP: same image, IMG%u.JPG stays\n", slot + 1);
+            http_done(size > 0);
+            led_status_fetch_end(true);
+            return slot_unchanged(slot, &cond_stats.same_content, written);
+        }
+        if (complete)
+        {
+            storage_image_publish(slot, buf, written);   // rest of the slot reads as zeros
+            validators_set(slot, hash);
+            t_published = millis();
+            published_bytes = written;
+            slot_unmap(slot);
+            Serial.printf("HTTP: fetched %u bytes, %u stored\n", written, buf->stored);
+            published = true;
+            if (cache_ok)
             {
-                memset(FILE_IMG_JPG + written, 0, capacity - written);
+                cache_put(buf);
             }
-            FILE_IMG_JPG_len = written;
-            Serial.printf("HTTP: fetched %u bytes\n", written);
         }
         else
         {
-            Serial.printf("HTTP: GET failed, code %d\n", code);
+            storage_image_abort(slot, buf);
+            Serial.printf("HTTP: discarded incomplete image, %u of %d bytes\n", written, size);
         }
+    }
+    else
+    {
+        Serial.printf("HTTP: GET failed, code %d\n", code);
+    }
 
-        http.end();
+    // A published image was read to its end. Without Content-Length the server closes the connection anyway
+    http_done(published && (size > 0));
+    led_status_fetch_end(published);
+    return published ? HTTP_FROM_SERVER : HTTP_FROM_NONE;
+}
+
+void http_client_sched_status(char *buf, size_t len)
+{
+    struct fetch_sched_stats st;
+    fetch_sched_stats(&st);
+    snprintf(buf, len, "%u opens, interval %u ms (+-%u), download %u ms (+-%u), prediction error last %d ms, mean %u ms over %u; "
+             "events: %u opened, %u finished, %u directory reads, %u start/stop, %u dropped",
+             st.opens, st.interval_ms, st.interval_dev_ms, st.download_ms, st.download_dev_ms,
+             (int)st.last_error_ms, st.mean_abs_error_ms, st.predictions,
+             event_counts[STORAGE_EV_SLOT_OPENED], event_counts[STORAGE_EV_SLOT_FINISHED],
+             event_counts[STORAGE_EV_DIR_READ], event_counts[STORAGE_EV_START_STOP], event_queue_dropped(&usb_events));
+}
+
+// Keeps the ring STORAGE_IMG_PREFETCH images ahead of the host, one download per call,
+// each started when the scheduler expects it to finish just in time (fetch_sched.h)
+void http_client_process(void)
+{
+    uint32_t cmd;
+    bool fetch_now = false;
+    while (xQueueReceive(command_queue, &cmd, 0) == pdTRUE)
+    {
+        commands++;
+        switch (cmd)
+        {
+        case HTTP_CMD_FETCH_NOW: fetch_now = true; retry_at = millis(); break;
+        case HTTP_CMD_PAUSE:     paused = true; break;
+        case HTTP_CMD_RESUME:    paused = false; break;
+        default: break;
+        }
+    }
+
+    struct storage_event ev;
+    while (event_queue_pop(&usb_events, &ev))
+    {
+        if (ev.type < STORAGE_EV_TYPES)
+        {
+            event_counts[ev.type]++;
+        }
+        if (ev.type == STORAGE_EV_SLOT_OPENED)
+        {
+            opened_slot = ev.slot;
+            fetch_sched_opened(ev.t_ms);
+            prefetch_pending = true;
+        }
+    }
+    if (fetch_now)
+    {
+        prefetch_pending = true;
+    }
+    if (paused || !prefetch_pending || ((int32_t)(millis() - retry_at) < 0) || (!fetch_now && (millis() < HTTP_BOOT_DELAY_MS)))
+    {
+        return;
+    }
+
+    const int32_t slot = storage_ring_next();
+    if (slot < 0)
+    {
+        prefetch_pending = false;   // ring is full
+        return;
+    }
+    const uint32_t ahead = (slot - opened_slot + STORAGE_IMG_SLOTS) % STORAGE_IMG_SLOTS;
+    if (!fetch_now && (fetch_sched_wait(millis(), ahead) > 0))
+    {
+        return;
+    }
+    const uint32_t t_start = millis();
+    const enum http_source got = http_fetch(slot);
+    if (got == HTTP_FROM_SERVER)
+    {
+        fetch_sched_downloaded(t_published - t_start);
+        post_result(slot, HTTP_FROM_SERVER, published_bytes, t_published - t_start);
+    }
+    else if (got == HTTP_UNCHANGED)
+    {
+        post_result(slot, HTTP_UNCHANGED, 0, millis() - t_start);  // no download to learn the time from
+    }
+    else if (got == HTTP_OVERSIZE)
+    {
+        post_result(slot, HTTP_OVERSIZE, 0, millis() - t_start);
+    }
+    else
+    {
+        retry_at = millis() + HTTP_RETRY_DELAY_MS;
+        if (cache_fill(slot))
+        {
+            Serial.printf("Cache: serving a cached image in IMG%u.JPG\n", slot + 1);
+            post_result(slot, HTTP_FROM_CACHE, 0, millis() - t_start);
+        }
+        else if (fallback_fill(slot))
+        {
+            Serial.printf("Fallback: serving image %u in IMG%u.JPG\n", (fallback_next - 1) % fallback_count() + 1, slot + 1);
+            post_result(slot, HTTP_FROM_FALLBACK, 0, millis() - t_start);
+        }
+        else
+        {
+            post_result(slot, HTTP_FROM_NONE, 0, millis() - t_start);
+        }
     }
 }
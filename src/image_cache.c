@@ -0,0 +1,507 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include "image_cache.h"
+
+#define IMAGE_CACHE_MAGIC 0x43474D49    // "IMGC"
+
+// Record header at the start of the first sector of every cached image, the image follows.
+// Written after the image, so a record with a valid header is complete
+struct cache_record
+{
+    uint32_t magic;
+    uint32_t seq;       // write order, newest highest
+    uint32_t len;       // image bytes
+    uint32_t crc;       // CRC-32 of the image
+    uint64_t hash;      // content address
+    uint32_t reserved;
+    uint32_t hdr_crc;   // CRC-32 of the header up to here
+};
+
+struct cache_entry
+{
+    uint64_t hash;
+    uint32_t addr;      // of the record
+    uint32_t len;
+    uint32_t seq;
+    uint32_t used;      // last use, for the LRU order
+    uint32_t pins;      // mapped into an image slot, must not be erased
+};
+
+static const struct cache_flash * cache_flash;
+static struct cache_entry cache_index[IMAGE_CACHE_MAX_ENTRIES];
+static uint32_t cache_entries;
+static uint32_t cache_head;     // where the next record goes
+static uint32_t cache_seq;      // of the newest record
+static uint32_t cache_clock;    // use counter
+static struct image_cache_stats cache_stats;
+
+// Streamed put in progress
+static struct
+{
+    bool active;
+    uint32_t addr;      // of the record
+    uint32_t len;       // announced
+    uint32_t written;
+    uint64_t hash;
+    uint32_t crc;
+} cache_stream;
+
+
+static uint32_t crc32_update(uint32_t crc, const void * data, uint32_t len)
+{
+    static const uint32_t TABLE[16] =
+    {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    const uint8_t * p = data;
+    crc = ~crc;
+    while (len--)
+    {
+        crc = TABLE[(crc ^ *p) & 0x0F] ^ (crc >> 4);
+        crc = TABLE[(crc ^ (*p >> 4)) & 0x0F] ^ (crc >> 4);
+        p++;
+    }
+    return ~crc;
+}
+
+
+#define FNV_OFFSET 0xCBF29CE484222325ULL
+
+static uint64_t fnv1a_update(uint64_t h, const void * data, uint32_t len)
+{
+    const uint8_t * p = data;
+    while (len--)
+    {
+        h ^= *p++;
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+
+uint64_t image_cache_hash(const void * data, uint32_t len)
+{
+    return fnv1a_update(FNV_OFFSET, data, len);
+}
+
+
+// Sectors a record of len image bytes takes
+static uint32_t record_span(uint32_t len)
+{
+    const uint32_t bytes = sizeof(struct cache_record) + len;
+    return ((bytes + IMAGE_CACHE_SECTOR - 1) / IMAGE_CACHE_SECTOR) * IMAGE_CACHE_SECTOR;
+}
+
+
+static bool record_valid(const struct cache_record * r, uint32_t addr)
+{
+    return (r->magic == IMAGE_CACHE_MAGIC)
+        && (r->hdr_crc == crc32_update(0, r, offsetof(struct cache_record, hdr_crc)))
+        && (r->len <= cache_flash->size)
+        && (addr + record_span(r->len) <= cache_flash->size);
+}
+
+
+static struct cache_entry * find_entry(uint64_t hash)
+{
+    for (uint32_t i = 0; i < cache_entries; i++)
+    {
+        if (cache_index[i].hash == hash)
+        {
+            return &cache_index[i];
+        }
+    }
+    return NULL;
+}
+
+
+static void drop_entry(struct cache_entry * e)
+{
+    cache_stats.bytes -= e->len;
+    *e = cache_index[--cache_entries];
+}
+
+
+// Add to the index, replacing an older copy of the same image or, if full, the least recently used one
+static void add_entry(const struct cache_entry * e)
+{
+    struct cache_entry * old = find_entry(e->hash);
+    if (old != NULL)
+    {
+        if (old->seq > e->seq)
+        {
+            return;
+        }
+        drop_entry(old);
+    }
+    if (cache_entries == IMAGE_CACHE_MAX_ENTRIES)
+    {
+        struct cache_entry * lru = &cache_index[0];
+        for (uint32_t i = 1; i < cache_entries; i++)
+        {
+            if (cache_index[i].used < lru->used)
+            {
+                lru = &cache_index[i];
+            }
+        }
+        drop_entry(lru);
+    }
+    cache_index[cache_entries++] = *e;
+    cache_stats.bytes += e->len;
+}
+
+
+int image_cache_mount(const struct cache_flash * flash)
+{
+    cache_flash = flash;
+    cache_entries = 0;
+    cache_head = 0;
+    cache_seq = 0;
+    cache_stream.active = false;
+    memset(&cache_stats, 0, sizeof(cache_stats));
+    cache_stats.size = flash->size;
+
+    // Records start on sector boundaries and never overlap, walk from one to the next
+    uint32_t addr = 0;
+    while (addr + IMAGE_CACHE_SECTOR <= flash->size)
+    {
+        struct cache_record r;
+        if (flash->read(flash->ctx, addr, &r, sizeof(r)) != 0)
+        {
+            cache_flash = NULL;
+            return -1;
+        }
+        if (!record_valid(&r, addr))
+        {
+            addr += IMAGE_CACHE_SECTOR;
+            continue;
+        }
+        const struct cache_entry e = { r.hash, addr, r.len, r.seq, r.seq, 0 };
+        add_entry(&e);
+        addr += record_span(r.len);
+        if (r.seq >= cache_seq)
+        {
+            cache_seq = r.seq;
+            cache_head = (addr < flash->size) ? addr : 0;
+        }
+    }
+    cache_clock = cache_seq;
+    cache_stats.entries = cache_entries;
+    return (int)cache_entries;
+}
+
+
+static struct cache_entry * pinned_in(uint32_t addr, uint32_t span)
+{
+    for (uint32_t i = 0; i < cache_entries; i++)
+    {
+        if ((cache_index[i].pins > 0) && (cache_index[i].addr < addr + span)
+         && (cache_index[i].addr + record_span(cache_index[i].len) > addr))
+        {
+            return &cache_index[i];
+        }
+    }
+    return NULL;
+}
+
+
+// Make room for a record of len bytes at the head of the log, erasing whatever is in its way
+// except images mapped into a slot, the log skips over those. Returns the address, -1 if there is no room
+static int32_t reserve(uint32_t len)
+{
+    const uint32_t span = record_span(len);
+    if (span > cache_flash->size)
+    {
+        return -1;
+    }
+    uint32_t addr = cache_head;
+    for (uint32_t tries = 0; ; tries++)
+    {
+        if (addr + span > cache_flash->size)
+        {
+            addr = 0;       // the tail of the partition keeps older records until overwritten
+        }
+        const struct cache_entry * pinned = pinned_in(addr, span);
+        if (pinned == NULL)
+        {
+            break;
+        }
+        if (tries > IMAGE_CACHE_MAX_ENTRIES)
+        {
+            return -1;
+        }
+        addr = pinned->addr + record_span(pinned->len);
+    }
+
+    for (uint32_t i = 0; i < cache_entries; )
+    {
+        if ((cache_index[i].addr >= addr) && (cache_index[i].addr < addr + span))
+        {
+            drop_entry(&cache_index[i]);
+            cache_stats.evictions++;
+            continue;
+        }
+        i++;
+    }
+    cache_stats.entries = cache_entries;
+    if (cache_flash->erase(cache_flash->ctx, addr, span) != 0)
+    {
+        return -1;
+    }
+    cache_stats.erases += span / IMAGE_CACHE_SECTOR;
+    return (int32_t)addr;
+}
+
+
+// Write the header of the record at addr, which makes it valid, and index it
+static int finish(uint32_t addr, uint32_t len, uint64_t hash, uint32_t crc)
+{
+    struct cache_record r;
+    memset(&r, 0xFF, sizeof(r));
+    r.magic = IMAGE_CACHE_MAGIC;
+    r.seq = cache_seq + 1;
+    r.len = len;
+    r.crc = crc;
+    r.hash = hash;
+    r.hdr_crc = crc32_update(0, &r, offsetof(struct cache_record, hdr_crc));
+    if (cache_flash->write(cache_flash->ctx, addr, &r, sizeof(r)) != 0)
+    {
+        return -1;
+    }
+    const uint32_t end = addr + record_span(len);
+    cache_seq = r.seq;
+    cache_head = (end < cache_flash->size) ? end : 0;
+
+    const struct cache_entry e = { hash, addr, len, r.seq, ++cache_clock, 0 };
+    add_entry(&e);
+    cache_stats.entries = cache_entries;
+    return 0;
+}
+
+
+// Append a record: image first, header last, a power cut in between leaves no valid record
+static int append(const void * data, uint32_t len, uint64_t hash, uint32_t crc)
+{
+    if (cache_stream.active)
+    {
+        return -1;      // the streamed put owns the head of the log
+    }
+    const int32_t addr = reserve(len);
+    if ((addr < 0) || (cache_flash->write(cache_flash->ctx, addr + sizeof(struct cache_record), data, len) != 0))
+    {
+        return -1;
+    }
+    return finish(addr, len, hash, crc);
+}
+
+
+int image_cache_put(const void * data, uint32_t len)
+{
+    if (cache_flash == NULL)
+    {
+        return -1;
+    }
+    const uint64_t hash = image_cache_hash(data, len);
+    struct cache_entry * e = find_entry(hash);
+    if ((e != NULL) && (e->len == len))
+    {
+        e->used = ++cache_clock;
+        cache_stats.dedups++;
+        return 0;
+    }
+    cache_stats.puts++;
+    return append(data, len, hash, crc32_update(0, data, len));
+}
+
+
+uint32_t image_cache_list(uint64_t * hashes, uint32_t max)
+{
+    // Insertion sort by last use, the index is small
+    uint32_t n = 0;
+    uint32_t used[IMAGE_CACHE_MAX_ENTRIES];
+    for (uint32_t i = 0; i < cache_entries; i++)
+    {
+        uint32_t j = (n < max) ? n++ : n;
+        while ((j > 0) && (used[j - 1] < cache_index[i].used))
+        {
+            if (j < max)
+            {
+                used[j] = used[j - 1];
+                hashes[j] = hashes[j - 1];
+            }
+            j--;
+        }
+        if (j < max)
+        {
+            used[j] = cache_index[i].used;
+            hashes[j] = cache_index[i].hash;
+        }
+    }
+    return n;
+}
+
+
+uint32_t image_cache_read(uint64_t hash, void * buf, uint32_t size)
+{
+    if (cache_flash == NULL)
+    {
+        return 0;
+    }
+    struct cache_entry * e = find_entry(hash);
+    if ((e == NULL) || (e->len > size))
+    {
+        return 0;
+    }
+    struct cache_record r;
+    if ((cache_flash->read(cache_flash->ctx, e->addr, &r, sizeof(r)) != 0)
+     || (cache_flash->read(cache_flash->ctx, e->addr + sizeof(r), buf, e->len) != 0)
+     || (r.hash != hash) || (r.crc != crc32_update(0, buf, e->len)))
+    {
+        drop_entry(e);      // corrupt, don't offer it again
+        cache_stats.entries = cache_entries;
+        return 0;
+    }
+    const uint32_t len = e->len;
+    e->used = ++cache_clock;
+    cache_stats.reads++;
+
+    // Next in line for eviction: move it to the head of the log. Mapped images stay where they are
+    const uint32_t ahead = (e->addr + cache_flash->size - cache_head) % cache_flash->size;
+    if ((ahead < cache_flash->size / 2) && (e->pins == 0))
+    {
+        cache_stats.moves++;
+        append(buf, len, hash, r.crc);
+    }
+    return len;
+}
+
+
+int image_cache_begin(uint32_t len)
+{
+    if (cache_flash == NULL)
+    {
+        return -1;
+    }
+    const int32_t addr = reserve(len);
+    cache_stream.active = (addr >= 0);
+    if (!cache_stream.active)
+    {
+        return -1;
+    }
+    cache_stream.addr = addr;
+    cache_stream.len = len;
+    cache_stream.written = 0;
+    cache_stream.hash = FNV_OFFSET;
+    cache_stream.crc = 0;
+    return 0;
+}
+
+
+int image_cache_write(const void * data, uint32_t len)
+{
+    if (!cache_stream.active || (len > cache_stream.len - cache_stream.written))
+    {
+        cache_stream.active = false;
+        return -1;
+    }
+    const uint32_t addr = cache_stream.addr + sizeof(struct cache_record) + cache_stream.written;
+    if (cache_flash->write(cache_flash->ctx, addr, data, len) != 0)
+    {
+        cache_stream.active = false;
+        return -1;
+    }
+    cache_stream.hash = fnv1a_update(cache_stream.hash, data, len);
+    cache_stream.crc = crc32_update(cache_stream.crc, data, len);
+    cache_stream.written += len;
+    return 0;
+}
+
+
+const void * image_cache_pending(void)
+{
+    if (!cache_stream.active || (cache_flash->map == NULL))
+    {
+        return NULL;
+    }
+    return cache_flash->map + cache_stream.addr + sizeof(struct cache_record);
+}
+
+
+int image_cache_commit(uint64_t * hash)
+{
+    if (!cache_stream.active || (cache_stream.written != cache_stream.len))
+    {
+        cache_stream.active = false;
+        return -1;
+    }
+    cache_stream.active = false;
+    *hash = cache_stream.hash;
+    struct cache_entry * e = find_entry(cache_stream.hash);
+    if ((e != NULL) && (e->len == cache_stream.len))
+    {
+        // Cached already: leave the copy without header, the head stays put and reuses the space
+        e->used = ++cache_clock;
+        cache_stats.dedups++;
+        return 0;
+    }
+    cache_stats.puts++;
+    return finish(cache_stream.addr, cache_stream.len, cache_stream.hash, cache_stream.crc);
+}
+
+
+void image_cache_cancel(void)
+{
+    cache_stream.active = false;
+}
+
+
+uint32_t image_cache_map(uint64_t hash, const void ** data)
+{
+    if ((cache_flash == NULL) || (cache_flash->map == NULL))
+    {
+        return 0;
+    }
+    struct cache_entry * e = find_entry(hash);
+    if (e == NULL)
+    {
+        return 0;
+    }
+    const uint8_t * p = cache_flash->map + e->addr + sizeof(struct cache_record);
+    if (crc32_update(0, p, e->len) != ((const struct cache_record *)(cache_flash->map + e->addr))->crc)
+    {
+        drop_entry(e);
+        cache_stats.entries = cache_entries;
+        return 0;
+    }
+    e->used = ++cache_clock;
+    cache_stats.maps++;
+    *data = p;
+    return e->len;
+}
+
+
+void image_cache_pin(uint64_t hash, bool pin)
+{
+    struct cache_entry * e = find_entry(hash);
+    if (e == NULL)
+    {
+        return;
+    }
+    if (pin)
+    {
+        e->pins++;
+    }
+    else if (e->pins > 0)
+    {
+        e->pins--;
+    }
+}
+
+
+void image_cache_stats(struct image_cache_stats * stats)
+{
+    *stats = cache_stats;
+}
@@ -0,0 +1,45 @@
+#include <stdint.h>
+#include "esp_partition.h"
+#include "image_cache.h"
+
+// Backend of the image cache on a data partition of the SPI flash (see partitions.csv)
+
+static int partition_read(void * ctx, uint32_t addr, void * buf, uint32_t len)
+{
+    return (esp_partition_read((const esp_partition_t *)ctx, addr, buf, len) == ESP_OK) ? 0 : -1;
+}
+
+static int partition_write(void * ctx, uint32_t addr, const void * buf, uint32_t len)
+{
+    return (esp_partition_write((const esp_partition_t *)ctx, addr, buf, len) == ESP_OK) ? 0 : -1;
+}
+
+static int partition_erase(void * ctx, uint32_t addr, uint32_t len)
+{
+    return (esp_partition_erase_range((const esp_partition_t *)ctx, addr, len) == ESP_OK) ? 0 : -1;
+}
+
+
+int image_cache_partition(struct cache_flash * flash, const char * label)
+{
+    const esp_partition_t * part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (part == NULL)
+    {
+        return -1;
+    }
+    flash->size = part->size & ~(uint32_t)(IMAGE_CACHE_SECTOR - 1);
+    flash->read = partition_read;
+    flash->write = partition_write;
+    flash->erase = partition_erase;
+    flash->ctx = (void *)part;
+
+    // Serve cached images straight from flash. Without a mapping the cache still works, through copies
+    const void * map = NULL;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, flash->size, ESP_PARTITION_MMAP_DATA, &map, &handle) != ESP_OK)
+    {
+        map = NULL;
+    }
+    flash->map = map;
+    return 0;
+}
@@ -1,298 +0,0 @@
-// IMG1.JPG
-// @LBA 2156 (0x0010d800)
-// Total size is 128kB (256 sectors, resp. 64 clusters), fill up the rest with zeros
-// Span is LBA 2156 .. 2411
-// Span is Cluster 4 .. 67
-const unsigned char FILE_IMG1_JPG[] = {
-  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x02, 0x00, 0x98,
-  0x00, 0x91, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x43, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x11, 0x08, 0x02, 0x58, 0x03, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
-  0x01, 0xff, 0xc4, 0x00, 0x17, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x03, 0xff, 0xc4, 0x00, 0x20, 0x10, 0x01,
-  0x01, 0x00, 0x03, 0x00, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x02, 0x11, 0x31, 0x41, 0x51, 0x21, 0x71, 0x81, 0x12, 0x61, 0x91, 0xff, 0xc4, 0x00, 0x16,
-  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0xff, 0xc4, 0x00, 0x17, 0x11, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x41, 0xff, 0xda, 0x00,
-  0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x74, 0x05,
-  0xba, 0x27, 0x10, 0xb9, 0xc1, 0x35, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xc6, 0x5b, 0xa4, 0x5b, 0xb0, 0x5c, 0xbb, 0x6a, 0x71, 0xe2, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xbb, 0xbf, 0xe2, 0x6d, 0xdf,
-  0xd1, 0x8f, 0x7f, 0x04, 0x74, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x36, 0xfa, 0x06, 0xda, 0x80, 0x19, 0x17, 0x38, 0x85, 0xce, 0x0b, 0x1a, 0x00, 0xa0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2d, 0xd1, 0x6e, 0xbe, 0xdc, 0xc4, 0xd6, 0xf5, 0x80,
-  0x22, 0xf1, 0xe2, 0x93, 0x8f, 0x14, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x2d, 0xd0, 0x16, 0xe9, 0xce, 0xdd, 0x96, 0xed, 0x82, 0x0a, 0xc7, 0xbf, 0x89, 0x56, 0x3d,
-  0xfc, 0x07, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0xec, 0x1b, 0x6a,
-  0x40, 0x64, 0x01, 0x01, 0x73, 0x88, 0x5c, 0xe2, 0xac, 0x68, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x9b, 0x7d, 0x17, 0x2f, 0x11, 0x02, 0x68, 0x00, 0x80, 0x00, 0xbc, 0x78, 0xa4,
-  0xe3, 0xc5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb9, 0x6b, 0xec, 0x1b,
-  0x6e, 0xbe, 0xdc, 0xfa, 0x30, 0x40, 0x00, 0x15, 0x8f, 0x7f, 0x12, 0xac, 0x7b, 0xf8, 0x0e, 0x80,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x74, 0x9b, 0x76, 0x25, 0xa5, 0xbb, 0x60, 0x22,
-  0x00, 0x00, 0x00, 0x0b, 0x9c, 0x42, 0xe7, 0x15, 0x63, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x45, 0xbb, 0xe3, 0x2d, 0xdf, 0xd3, 0x04, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x17, 0x8f, 0x14,
-  0x9c, 0x78, 0xa1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x72, 0xf1, 0x01, 0xb7, 0x2f,
-  0x11, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x15, 0x8f, 0x7f, 0x12, 0xac, 0x7b, 0xf8, 0x0e, 0x80, 0x0a,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xdd, 0x16, 0xe9, 0x02, 0x5a, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0xe7, 0x10, 0xb9, 0xc5, 0x58, 0xd0, 0x05, 0x00, 0x00, 0x00, 0x01, 0x96, 0xe8, 0x0b, 0x74,
-  0x8b, 0x76, 0x5b, 0xb6, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x1e, 0x29, 0x38, 0xf1,
-  0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0xed, 0xdf, 0xd0, 0x17, 0x2d, 0xfd, 0x24, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0xf7, 0xf1, 0x2a, 0xc7, 0xbf, 0x80, 0xe8, 0x00, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x26, 0xd2, 0xdf, 0x49, 0x12, 0xd0, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73,
-  0x88, 0x5c, 0xe2, 0xac, 0x68, 0x02, 0x80, 0x00, 0x09, 0xb7, 0x5f, 0x60, 0xdb, 0x74, 0x86, 0x02,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x78, 0xa4, 0xe3, 0xc5, 0x0d, 0x00, 0x00,
-  0x00, 0x0c, 0xb7, 0x45, 0xba, 0x73, 0xb7, 0x60, 0x5b, 0xb6, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0xb1, 0xef, 0xe2, 0x55, 0x8f, 0x7f, 0x01, 0xd0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xcb, 0x76,
-  0xc1, 0x2d, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x89, 0x93, 0x6b,
-  0x55, 0x80, 0x02, 0x80, 0x8b, 0x7d, 0x03, 0x6d, 0xf4, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1b, 0x26, 0xc1, 0x58, 0xf1, 0x4c, 0x93, 0x4d, 0x1a, 0x00, 0x01, 0x36, 0xeb,
-  0xec, 0xb9, 0x6b, 0xe2, 0x75, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x58, 0xf7, 0xf1, 0x8b, 0xc6, 0x6b, 0xec, 0x14, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xdd, 0x03, 0x78, 0x8b, 0x76, 0x6f, 0x6c,
-  0x19, 0xb4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x26, 0xdb, 0x22, 0x95,
-  0x64, 0x00, 0x14, 0x0e, 0x39, 0xdb, 0xb0, 0x6d, 0xbb, 0xfa, 0x48, 0x0c, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0x93, 0x60, 0x49, 0xb5, 0xc9, 0xa6, 0xf0, 0x1a, 0x00, 0x01, 0x17,
-  0x2f, 0x13, 0xfe, 0x97, 0x2d, 0xfc, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x37, 0xa4, 0x9b, 0x74, 0x93, 0x40, 0x49, 0xaf, 0xb6, 0x80, 0xa0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xdd, 0x01, 0x6e, 0x90, 0x03,
-  0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x3d, 0xb6, 0x46, 0xaa, 0xc8,
-  0x00, 0x28, 0xcb, 0x74, 0x5b, 0xa4, 0x5b, 0xb1, 0x0b, 0x76, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x54, 0x9e, 0xc0, 0x93, 0x7f, 0x4b, 0x01, 0xa0, 0x19, 0x6e, 0x81, 0xae,
-  0x76, 0xef, 0xe8, 0xb7, 0x69, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c,
-  0x9b, 0x6c, 0x9b, 0xfa, 0x74, 0xe0, 0x32, 0x4d, 0x34, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0xfa, 0x02, 0xdf, 0x49, 0x01, 0x90,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x02, 0xe4, 0xd1, 0x26, 0x9a, 0xab, 0x20,
-  0x00, 0xa3, 0x2d, 0xd7, 0xdb, 0x2d, 0xf4, 0x81, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x72, 0x6b, 0xec, 0x52, 0x4f, 0x6a, 0x01, 0x40, 0x65, 0xba, 0x02, 0xdd, 0x39,
-  0xdb, 0xb2, 0xdd, 0xb0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x1d,
-  0xf7, 0x8d, 0x98, 0xf9, 0xab, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xbb, 0x0d, 0x2d, 0xdb, 0x00, 0x64, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x26, 0xc0, 0x93, 0x6a, 0x93, 0x4d, 0x15, 0x70, 0x00, 0x51,
-  0x37, 0x2f, 0x11, 0x96, 0xfa, 0x48, 0x9a, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0d, 0x24, 0xda, 0xe4, 0xd0, 0xa4, 0x9a, 0x68, 0x0a, 0x02, 0x6e, 0x5e, 0x20, 0x17, 0x2d, 0x7d,
-  0xa1, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x41, 0x8e, 0x93, 0x1f, 0x34,
-  0x98, 0xeb, 0xed, 0x40, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xcb, 0x74, 0x5b, 0xa4, 0x74, 0x4b, 0x5b, 0x6e, 0xd8, 0x08, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa4, 0xf6, 0xa3, 0x24, 0xda, 0xc0, 0x68, 0x02, 0xdd,
-  0x00, 0x8b, 0x77, 0xf4, 0xcb, 0x76, 0xc1, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1b, 0x26, 0xc9, 0x37, 0xf4, 0xe8, 0x2e, 0x32, 0x4d, 0x34, 0x05, 0x01, 0xce, 0xe5, 0xbe,
-  0x70, 0x1b, 0x72, 0xf1, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x93,
-  0x60, 0x49, 0xb7, 0x49, 0x34, 0x49, 0xa6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2d, 0xd1, 0x6e, 0x90, 0x25, 0xa0, 0x08, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe4, 0xd2, 0x8c, 0x93, 0xda, 0x80, 0x68, 0x06,
-  0x5b, 0xa0, 0x2d, 0xd2, 0x2d, 0xd9, 0xd6, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x93, 0x64, 0x9e, 0x6a, 0xc5, 0xc0, 0x01, 0x43, 0x85, 0xf8, 0x72, 0xb7, 0x60, 0xdb,
-  0x77, 0xf4, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x9b, 0xfa, 0x02,
-  0x4d, 0xae, 0x4d, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x75, 0x2a, 0xcb, 0xa9, 0x19, 0xa0, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0xda, 0xa4, 0xd2, 0x98, 0x49, 0xa6, 0x80, 0xd0, 0x00, 0x09,
-  0xcb, 0x8a, 0x4e, 0x5c, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe4,
-  0xf6, 0xd9, 0x35, 0xf6, 0xd1, 0x70, 0x00, 0x50, 0x00, 0x65, 0xe5, 0x72, 0x75, 0xbc, 0xae, 0x42,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x1f, 0x37, 0xfe, 0x01, 0x31, 0xdf,
-  0xcd, 0x58, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xcb, 0xa9, 0x56, 0x5d, 0x48, 0xcd, 0x00, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0xc9, 0xb2, 0x4d, 0xad, 0x56, 0x43, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x27, 0x2e,
-  0x29, 0x39, 0x70, 0x10, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x36, 0x07, 0x57, 0x26,
-  0x89, 0x34, 0xd1, 0x40, 0x05, 0x00, 0x00, 0x00, 0x65, 0xe5, 0x72, 0x75, 0xbc, 0xae, 0x42, 0x50,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa2, 0xe4, 0xd7, 0xd8, 0x13, 0x1d, 0x7c, 0xde, 0xa8, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x5d, 0x4a, 0xb2, 0xea, 0x46, 0x68, 0x02, 0x00, 0x00, 0x00, 0x02,
-  0xa4, 0x24, 0xf6, 0xa5, 0x59, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x71, 0x49, 0xcb,
-  0x80, 0x80, 0x06, 0x40, 0x00, 0x00, 0x00, 0x54, 0x9b, 0xfa, 0x06, 0x49, 0xb7, 0x4d, 0x68, 0x06,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x79, 0x5c, 0x9d, 0x6f, 0x2b, 0x90, 0x94, 0x00, 0x00,
-  0x00, 0x00, 0x06, 0xc9, 0xb2, 0x4d, 0xba, 0x49, 0xa0, 0x24, 0xd3, 0x40, 0x50, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x4e, 0x5d, 0x4a, 0xb2, 0xea, 0x46, 0x68, 0x02, 0x00, 0x00, 0x2a, 0x46, 0xc9, 0xa6,
-  0xaa, 0xc8, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb8, 0xa4, 0xe5, 0xc0, 0x40,
-  0x03, 0x20, 0x00, 0x02, 0xe6, 0x3e, 0x68, 0x32, 0x4f, 0x6b, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x65, 0xe5, 0x72, 0x75, 0xbc, 0xae, 0x42, 0x50, 0x00, 0x00, 0x01, 0x52, 0x6f,
-  0xe8, 0x98, 0xef, 0xe9, 0xd0, 0x0e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72,
-  0xea, 0x55, 0x97, 0x52, 0x33, 0x40, 0x6c, 0x9b, 0x41, 0x8b, 0x93, 0x44, 0x9a, 0x6a, 0xac, 0x80,
-  0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb8, 0xa4, 0xe5, 0xc0, 0x40, 0x03,
-  0x20, 0x3a, 0x49, 0xaf, 0xb1, 0x59, 0x26, 0xba, 0xa0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x97, 0x95, 0xc9, 0xd6, 0xf2, 0xb9, 0x09, 0x40, 0x00, 0x5c, 0xc7, 0xcd, 0x26,
-  0x3e, 0x6a, 0xc0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x5d, 0x4a,
-  0xb2, 0xeb, 0x24, 0xd8, 0xcf, 0x49, 0x36, 0xb0, 0x17, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x97, 0x14, 0x9c, 0xb8, 0x08, 0x6c, 0x9b, 0x24, 0xda, 0xe4, 0xd0,
-  0x84, 0x9a, 0x68, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbc,
-  0xae, 0x4e, 0xb7, 0x95, 0xcf, 0xa2, 0x51, 0x73, 0x1d, 0x7d, 0xb6, 0x4d, 0x7d, 0xb4, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xb7, 0x5a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xcd, 0xb4, 0x03, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2f, 0xcc, 0x24, 0xd3,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x96, 0xe8, 0x1a, 0x23, 0xfa, 0xa7, 0xf4, 0x26, 0xac, 0x64, 0xbb, 0x68, 0xa0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xfc, 0x40, 0x68, 0x8f, 0xea,
-  0x9f, 0xd5, 0x13, 0x56, 0x23, 0xfa, 0xaa, 0x9c, 0x15, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
-  0x77, 0xb5, 0xd1, 0xce, 0xf4, 0x4a, 0xc0, 0x04, 0x56, 0x3d, 0x5a, 0x31, 0xea, 0xc5, 0x80, 0x02,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xca, 0xd6, 0x5e, 0x50,
-  0x73, 0x00, 0x64, 0x74, 0x9c, 0x8e, 0x6e, 0x93, 0x90, 0x58, 0xd0, 0x05, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xe7, 0xb3, 0x73, 0xd8, 0x34, 0x66, 0xe7, 0xb6, 0x80, 0x00,
-  0x00, 0x00, 0x33, 0x73, 0xd9, 0xb9, 0xec, 0x1a, 0x33, 0x71, 0xa0, 0x00, 0x00, 0x00, 0x32, 0xcd,
-  0xb4, 0x04, 0xff, 0x00, 0x3f, 0xe9, 0xfc, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x6e, 0x7b, 0x37, 0x3d, 0x83, 0x46, 0x6e, 0x7b, 0x68, 0x00, 0x00, 0x00, 0x0c, 0xbc, 0xad,
-  0x65, 0xe5, 0x07, 0x30, 0x06, 0x47, 0x49, 0xc8, 0xe6, 0xe9, 0x39, 0x05, 0x8d, 0x00, 0x50, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0xe5, 0xe1, 0x0b, 0xcb, 0xc2, 0x04, 0xa3, 0xa6, 0x3c, 0x73, 0x6c, 0xba, 0x05,
-  0x5b, 0xa4, 0xee, 0xd6, 0x00, 0x00, 0x20, 0xdd, 0xd8, 0xc0, 0x17, 0x2e, 0xd4, 0xe4, 0xab, 0x76,
-  0x2e, 0x97, 0x2f, 0x49, 0x01, 0x00, 0x00, 0x6c, 0xb6, 0x30, 0x07, 0x49, 0x76, 0xd7, 0x39, 0x75,
-  0x5d, 0x06, 0x80, 0x00, 0x73, 0xbd, 0xae, 0x8e, 0x77, 0xb4, 0x4a, 0xc0, 0x04, 0x56, 0x3d, 0xfc,
-  0x5a, 0x31, 0xef, 0xe2, 0xc5, 0x80, 0x02, 0xa7, 0x2f, 0x08, 0x5e, 0x5e, 0x10, 0x25, 0x1d, 0x27,
-  0x1c, 0xdb, 0x2e, 0x81, 0x56, 0xe9, 0x3b, 0xb5, 0x80, 0x00, 0x08, 0x37, 0x7a, 0x60, 0x0b, 0x99,
-  0x7b, 0x53, 0x92, 0xf1, 0xbb, 0x16, 0x28, 0x01, 0x46, 0x5e, 0x56, 0xb2, 0xf2, 0x83, 0x98, 0x03,
-  0x23, 0xa4, 0xe4, 0x73, 0x74, 0x9c, 0x82, 0xc6, 0x80, 0x28, 0xe4, 0xea, 0xe4, 0x25, 0x00, 0x11,
-  0x78, 0xf3, 0xf5, 0x49, 0xc7, 0x9f, 0xaa, 0x1a, 0x00, 0x01, 0xc9, 0xd5, 0xc8, 0x4a, 0x00, 0x22,
-  0xf1, 0xf2, 0xa4, 0xe3, 0xe5, 0x43, 0x50, 0x73, 0xb3, 0x4e, 0x8c, 0xb3, 0x60, 0xe6, 0x00, 0xc8,
-  0xe9, 0x2e, 0xdc, 0xd5, 0x2e, 0x85, 0x8b, 0x00, 0x51, 0xce, 0xdd, 0xd5, 0x65, 0x7c, 0x20, 0x4a,
-  0x00, 0x23, 0x7a, 0xb9, 0x34, 0xcc, 0x66, 0x94, 0x2c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x97, 0x84, 0x2f, 0x2f, 0x08, 0x12, 0x80,
-  0x08, 0x2f, 0xf9, 0xf6, 0x63, 0x3c, 0xa8, 0x5c, 0x4f, 0xf3, 0x19, 0x66, 0x96, 0x0b, 0x8e, 0x43,
-  0x6f, 0x58, 0x32, 0x00, 0x0d, 0x93, 0x6a, 0xfe, 0x5b, 0x26, 0xa3, 0x45, 0xc4, 0xff, 0x00, 0x31,
-  0x36, 0x69, 0xd1, 0x97, 0xe6, 0x06, 0x39, 0x80, 0x20, 0xe9, 0x38, 0xe6, 0xbc, 0x78, 0x2c, 0x50,
-  0x02, 0x8e, 0x77, 0xb5, 0xd1, 0xce, 0xf6, 0x89, 0x58, 0x00, 0x8a, 0xc7, 0xbf, 0x8b, 0x46, 0x3d,
-  0xfc, 0x58, 0xb0, 0x00, 0x54, 0xe5, 0xe1, 0x0b, 0xcb, 0xc2, 0x04, 0xa0, 0x02, 0x0b, 0xfe, 0x7d,
-  0x98, 0xcf, 0x2a, 0x17, 0x13, 0xfc, 0xc6, 0x5c, 0x7d, 0x2c, 0x15, 0xc8, 0x56, 0x53, 0xe5, 0x23,
-  0x23, 0x67, 0x58, 0xd0, 0x74, 0x00, 0x68, 0x65, 0xe5, 0x6b, 0x2f, 0x28, 0x39, 0x80, 0x32, 0x3a,
-  0x4e, 0x47, 0x37, 0x49, 0xc8, 0x2c, 0x68, 0x02, 0x8e, 0x4e, 0xae, 0x42, 0x50, 0x01, 0x17, 0x8f,
-  0x3f, 0x54, 0x9c, 0x79, 0xfa, 0xa1, 0xa0, 0x00, 0x1c, 0x9d, 0x5c, 0x84, 0xa0, 0x02, 0x2f, 0x1f,
-  0x2a, 0x4e, 0x3e, 0x54, 0x35, 0x00, 0x01, 0x39, 0x4f, 0x28, 0x75, 0x45, 0x9a, 0x12, 0xa4, 0x01,
-  0x17, 0x8d, 0xdb, 0x6d, 0xd2, 0x27, 0xc1, 0x6e, 0xc5, 0xd6, 0x00, 0x20, 0xac, 0x67, 0x96, 0x49,
-  0xb7, 0x41, 0x60, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xcb, 0xc2, 0x17, 0x97, 0x84, 0x09, 0x40, 0x04, 0x75, 0x9c, 0x00, 0x68,
-  0x00, 0x1c, 0xf2, 0xeb, 0x15, 0x97, 0x52, 0x32, 0x36, 0x76, 0x31, 0x58, 0xf4, 0x16, 0x00, 0xd0,
-  0x00, 0x39, 0x00, 0x32, 0x2f, 0x14, 0x2f, 0x11, 0x62, 0x80, 0x14, 0x73, 0xbd, 0xae, 0x8e, 0x77,
-  0xb4, 0x4a, 0xc0, 0x04, 0x56, 0x3d, 0xfc, 0x5a, 0x31, 0xef, 0xe2, 0xc5, 0x80, 0x02, 0xa7, 0x2f,
-  0x08, 0x5e, 0x5e, 0x10, 0x25, 0x01, 0xb0, 0x47, 0x40, 0x06, 0x80, 0x01, 0x39, 0x78, 0x42, 0xf2,
-  0x40, 0x94, 0x00, 0x47, 0x50, 0x06, 0x86, 0x5e, 0x56, 0xb2, 0xf2, 0x83, 0x98, 0x03, 0x23, 0xa4,
-  0xe4, 0x73, 0x74, 0x9c, 0x82, 0xc6, 0x80, 0x28, 0xe4, 0xea, 0xe4, 0x25, 0x00, 0x11, 0x78, 0xf3,
-  0xf5, 0x49, 0xc7, 0x9f, 0xaa, 0x1a, 0x00, 0x01, 0xc9, 0xd5, 0xc8, 0x4a, 0x00, 0x22, 0xf1, 0xf2,
-  0xa4, 0xe3, 0xe5, 0x43, 0x50, 0x00, 0x02, 0xfc, 0x80, 0x39, 0xdf, 0x86, 0x2f, 0x29, 0xf0, 0x81,
-  0x00, 0x04, 0x01, 0x58, 0xcf, 0x20, 0xa9, 0x34, 0xd0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xe1, 0x0b, 0xcb, 0xc2,
-  0x04, 0xa0, 0x02, 0x3a, 0x80, 0x34, 0x00, 0x08, 0xcb, 0xa9, 0x56, 0x5d, 0x48, 0x82, 0xb1, 0xea,
-  0x55, 0x8f, 0x41, 0x60, 0x0a, 0x00, 0x0e, 0x40, 0x0c, 0x8b, 0xc5, 0x0b, 0xc4, 0x58, 0xa0, 0x05,
-  0x1c, 0xef, 0x6b, 0xa3, 0x9d, 0xed, 0x12, 0xb0, 0x01, 0x15, 0x8f, 0x7f, 0x16, 0x8c, 0x7b, 0xf8,
-  0xb1, 0x60, 0x00, 0xa9, 0xcb, 0xc2, 0x17, 0x97, 0x84, 0x09, 0x46, 0xce, 0xcf, 0xb6, 0x36, 0x76,
-  0x7d, 0x88, 0xe8, 0x00, 0xd0, 0x00, 0x27, 0x24, 0x2f, 0x24, 0x09, 0x40, 0x04, 0x75, 0x00, 0x68,
-  0x65, 0xe5, 0x6b, 0x2f, 0x28, 0x39, 0x80, 0x32, 0x3a, 0x4e, 0x47, 0x37, 0x49, 0xc8, 0x2c, 0x68,
-  0x02, 0x8e, 0x4e, 0xae, 0x42, 0x50, 0x01, 0x17, 0x8f, 0x3f, 0x54, 0x9c, 0x78, 0xa1, 0xa0, 0x00,
-  0x1c, 0x9d, 0x2f, 0x2b, 0x98, 0x94, 0x00, 0x45, 0xe3, 0xe5, 0x49, 0xc7, 0xca, 0x86, 0xa0, 0x00,
-  0x00, 0x9c, 0xae, 0x81, 0x99, 0x5d, 0xa4, 0x06, 0x40, 0x00, 0x6c, 0xba, 0x60, 0x0e, 0xa2, 0x31,
-  0xbe, 0x16, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xcb, 0xc2, 0x17, 0x97, 0x84, 0x09, 0x40, 0x04, 0x75, 0x00, 0x68, 0x00,
-  0x11, 0x97, 0x52, 0xac, 0xba, 0x91, 0x05, 0x63, 0xd4, 0xab, 0x1e, 0x82, 0xc0, 0x14, 0x00, 0x1c,
-  0x80, 0x19, 0x17, 0x8a, 0x17, 0x88, 0xb1, 0x40, 0x0a, 0x39, 0xde, 0xd7, 0x47, 0x3b, 0xda, 0x25,
-  0x60, 0x02, 0x2b, 0x1e, 0xfe, 0x2d, 0x18, 0xf7, 0xf1, 0x62, 0xc0, 0x01, 0x53, 0x97, 0x84, 0x2f,
-  0x2f, 0x08, 0x12, 0x8d, 0x9d, 0x9f, 0x6c, 0x6c, 0xec, 0xfb, 0x11, 0xd0, 0x01, 0xa0, 0x00, 0x4e,
-  0x48, 0x5e, 0x48, 0x12, 0x80, 0x08, 0xea, 0x00, 0xd0, 0xcb, 0xca, 0xd6, 0x5e, 0x50, 0x73, 0x00,
-  0x64, 0x74, 0x9c, 0x8e, 0x6e, 0x93, 0x90, 0x58, 0xd0, 0x05, 0x1c, 0x9d, 0x5c, 0xef, 0x44, 0xac,
-  0x00, 0x45, 0x63, 0x75, 0x56, 0xe4, 0xd9, 0x6c, 0x15, 0xd0, 0x47, 0xf5, 0x59, 0x6d, 0xa1, 0xad,
-  0xca, 0xf8, 0x48, 0x08, 0x00, 0x0b, 0xc7, 0xca, 0x93, 0x8f, 0x95, 0x0d, 0x40, 0x00, 0x65, 0xba,
-  0x41, 0x6e, 0xd8, 0x25, 0x01, 0xb3, 0xe4, 0x46, 0xe3, 0x3c, 0xb7, 0x29, 0xe5, 0x5c, 0x06, 0x9c,
-  0x86, 0xd9, 0xa6, 0x0c, 0x8e, 0x92, 0xed, 0xcd, 0xb2, 0xe8, 0x57, 0x40, 0xe8, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0xf0, 0x85,
-  0xe5, 0x36, 0x9d, 0x5f, 0x42, 0x56, 0x0d, 0xd5, 0xf4, 0x6a, 0xfa, 0x11, 0xd0, 0x01, 0xa0, 0x00,
-  0x46, 0x5d, 0x4a, 0xac, 0xbb, 0x66, 0xaf, 0xa1, 0x18, 0xac, 0x7a, 0xcd, 0x5f, 0x4d, 0x92, 0xec,
-  0x16, 0x00, 0xa0, 0x00, 0xe4, 0x37, 0x57, 0xd1, 0xab, 0xe8, 0x65, 0x8b, 0xc5, 0x3a, 0xbe, 0x95,
-  0x8c, 0xd0, 0xb1, 0x40, 0x0a, 0x39, 0xde, 0xd7, 0x44, 0x59, 0x76, 0x25, 0x48, 0xdd, 0x5f, 0x46,
-  0xaf, 0xa1, 0x1b, 0x8f, 0x7f, 0x16, 0x9c, 0x65, 0x95, 0x43, 0x50, 0x00, 0x13, 0x97, 0x84, 0x2f,
-  0x29, 0xbd, 0x27, 0x57, 0xd0, 0x95, 0x8d, 0x9d, 0x9f, 0x66, 0xaf, 0xa6, 0xc9, 0x77, 0xc0, 0x58,
-  0x02, 0x80, 0x02, 0x72, 0x42, 0xf2, 0x9b, 0x4e, 0xaf, 0xa1, 0x2b, 0x06, 0xea, 0xfa, 0x35, 0x7d,
-  0x08, 0xe8, 0x00, 0xd0, 0xcb, 0xca, 0xd6, 0x5e, 0x03, 0x98, 0xdd, 0x5f, 0x46, 0xaf, 0xa1, 0x96,
-  0x3a, 0x4e, 0x44, 0x6a, 0xfa, 0x5c, 0xe4, 0x16, 0x34, 0x01, 0x46, 0x59, 0xb6, 0x80, 0xe4, 0x3a,
-  0x59, 0x2a, 0x7f, 0x9a, 0x26, 0x24, 0x6b, 0x04, 0x06, 0xea, 0xb6, 0x63, 0x41, 0x93, 0xe5, 0xb6,
-  0x6b, 0x4a, 0x93, 0x45, 0x9b, 0x82, 0xe3, 0x98, 0xdd, 0x5f, 0x46, 0xaf, 0xa1, 0x15, 0x8f, 0x95,
-  0x27, 0x19, 0xa5, 0x0d, 0x09, 0xca, 0xf8, 0x55, 0x73, 0xd5, 0x12, 0xb0, 0x6e, 0xaf, 0xa3, 0x57,
-  0xd0, 0x8c, 0x5e, 0x33, 0x4c, 0x93, 0xe7, 0xe5, 0x62, 0xc0, 0x01, 0x59, 0x66, 0xdc, 0xdd, 0x53,
-  0x94, 0xdf, 0x04, 0xa8, 0x1b, 0xab, 0xe8, 0xd5, 0xf4, 0x23, 0x65, 0xd2, 0xdc, 0xf5, 0x7d, 0x2e,
-  0x6f, 0xc8, 0xb1, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd9
-};
-const unsigned int FILE_IMG1_JPG_len = 4633;
@@ -1,639 +0,0 @@
-// IMG2.JPG
-// @LBA 2412 (0x0012d800)
-// Total size is 128kB (256 sectors, resp. 64 clusters), fill up the rest with zeros
-// Span is LBA 2412 .. 2668
-// Span is Cluster 68 .. 131
-const unsigned char FILE_IMG2_JPG[] = {
-  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x01, 0x2c,
-  0x01, 0x2c, 0x00, 0x00, 0xff, 0xe1, 0x00, 0xae, 0x45, 0x78, 0x69, 0x66, 0x00, 0x00, 0x49, 0x49,
-  0x2a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
-  0x1b, 0x01, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x28, 0x01, 0x03, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x01, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x72, 0x00, 0x00, 0x00, 0x32, 0x01, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x69, 0x87, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x47, 0x49, 0x4d, 0x50, 0x20, 0x32, 0x2e, 0x31, 0x30, 0x2e, 0x33, 0x36, 0x00, 0x00, 0x32, 0x30,
-  0x32, 0x36, 0x3a, 0x30, 0x32, 0x3a, 0x32, 0x30, 0x20, 0x30, 0x37, 0x3a, 0x34, 0x30, 0x3a, 0x30,
-  0x34, 0x00, 0x01, 0x00, 0x01, 0xa0, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x0c, 0xcf, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x6e,
-  0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70, 0x2f,
-  0x31, 0x2e, 0x30, 0x2f, 0x00, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x62,
-  0x65, 0x67, 0x69, 0x6e, 0x3d, 0x22, 0xef, 0xbb, 0xbf, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x57,
-  0x35, 0x4d, 0x30, 0x4d, 0x70, 0x43, 0x65, 0x68, 0x69, 0x48, 0x7a, 0x72, 0x65, 0x53, 0x7a, 0x4e,
-  0x54, 0x63, 0x7a, 0x6b, 0x63, 0x39, 0x64, 0x22, 0x3f, 0x3e, 0x20, 0x3c, 0x78, 0x3a, 0x78, 0x6d,
-  0x70, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x3d, 0x22, 0x61,
-  0x64, 0x6f, 0x62, 0x65, 0x3a, 0x6e, 0x73, 0x3a, 0x6d, 0x65, 0x74, 0x61, 0x2f, 0x22, 0x20, 0x78,
-  0x3a, 0x78, 0x6d, 0x70, 0x74, 0x6b, 0x3d, 0x22, 0x58, 0x4d, 0x50, 0x20, 0x43, 0x6f, 0x72, 0x65,
-  0x20, 0x34, 0x2e, 0x34, 0x2e, 0x30, 0x2d, 0x45, 0x78, 0x69, 0x76, 0x32, 0x22, 0x3e, 0x20, 0x3c,
-  0x72, 0x64, 0x66, 0x3a, 0x52, 0x44, 0x46, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x72, 0x64,
-  0x66, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33,
-  0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x31, 0x39, 0x39, 0x39, 0x2f, 0x30, 0x32, 0x2f, 0x32, 0x32, 0x2d,
-  0x72, 0x64, 0x66, 0x2d, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6e, 0x73, 0x23, 0x22, 0x3e,
-  0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x72, 0x64, 0x66, 0x3a, 0x61, 0x62, 0x6f, 0x75, 0x74, 0x3d, 0x22, 0x22, 0x20, 0x78,
-  0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70,
-  0x3a, 0x2f, 0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f,
-  0x78, 0x61, 0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x6d, 0x6d, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c,
-  0x6e, 0x73, 0x3a, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f,
-  0x2f, 0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61,
-  0x70, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x73, 0x54, 0x79, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x23, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e,
-  0x73, 0x3a, 0x64, 0x63, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x70, 0x75, 0x72,
-  0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x64, 0x63, 0x2f, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x73, 0x2f, 0x31, 0x2e, 0x31, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3a, 0x47, 0x49,
-  0x4d, 0x50, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x67,
-  0x69, 0x6d, 0x70, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x78, 0x6d, 0x70, 0x2f, 0x22, 0x20, 0x78, 0x6d,
-  0x6c, 0x6e, 0x73, 0x3a, 0x78, 0x6d, 0x70, 0x3d, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
-  0x6e, 0x73, 0x2e, 0x61, 0x64, 0x6f, 0x62, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x78, 0x61, 0x70,
-  0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x44, 0x6f, 0x63,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x67, 0x69, 0x6d, 0x70, 0x3a, 0x64, 0x6f,
-  0x63, 0x69, 0x64, 0x3a, 0x67, 0x69, 0x6d, 0x70, 0x3a, 0x66, 0x64, 0x32, 0x33, 0x66, 0x37, 0x39,
-  0x35, 0x2d, 0x38, 0x63, 0x38, 0x39, 0x2d, 0x34, 0x65, 0x66, 0x31, 0x2d, 0x38, 0x31, 0x63, 0x34,
-  0x2d, 0x35, 0x31, 0x38, 0x39, 0x39, 0x32, 0x64, 0x38, 0x31, 0x66, 0x35, 0x38, 0x22, 0x20, 0x78,
-  0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d,
-  0x22, 0x78, 0x6d, 0x70, 0x2e, 0x69, 0x69, 0x64, 0x3a, 0x37, 0x36, 0x35, 0x38, 0x37, 0x32, 0x64,
-  0x33, 0x2d, 0x34, 0x63, 0x61, 0x36, 0x2d, 0x34, 0x62, 0x39, 0x39, 0x2d, 0x62, 0x38, 0x30, 0x35,
-  0x2d, 0x37, 0x31, 0x39, 0x65, 0x39, 0x31, 0x61, 0x35, 0x39, 0x34, 0x37, 0x66, 0x22, 0x20, 0x78,
-  0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x44, 0x6f, 0x63,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e, 0x64, 0x69, 0x64,
-  0x3a, 0x66, 0x38, 0x34, 0x38, 0x65, 0x64, 0x36, 0x39, 0x2d, 0x37, 0x34, 0x38, 0x62, 0x2d, 0x34,
-  0x32, 0x64, 0x36, 0x2d, 0x38, 0x30, 0x38, 0x62, 0x2d, 0x62, 0x62, 0x66, 0x33, 0x39, 0x35, 0x38,
-  0x38, 0x37, 0x39, 0x63, 0x38, 0x22, 0x20, 0x64, 0x63, 0x3a, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74,
-  0x3d, 0x22, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x6a, 0x70, 0x65, 0x67, 0x22, 0x20, 0x47, 0x49,
-  0x4d, 0x50, 0x3a, 0x41, 0x50, 0x49, 0x3d, 0x22, 0x32, 0x2e, 0x30, 0x22, 0x20, 0x47, 0x49, 0x4d,
-  0x50, 0x3a, 0x50, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x3d, 0x22, 0x4c, 0x69, 0x6e, 0x75,
-  0x78, 0x22, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x3a, 0x54, 0x69, 0x6d, 0x65, 0x53, 0x74, 0x61, 0x6d,
-  0x70, 0x3d, 0x22, 0x31, 0x37, 0x37, 0x31, 0x35, 0x36, 0x39, 0x36, 0x30, 0x39, 0x36, 0x38, 0x39,
-  0x31, 0x32, 0x36, 0x22, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x3a, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x3d, 0x22, 0x32, 0x2e, 0x31, 0x30, 0x2e, 0x33, 0x36, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a,
-  0x43, 0x72, 0x65, 0x61, 0x74, 0x6f, 0x72, 0x54, 0x6f, 0x6f, 0x6c, 0x3d, 0x22, 0x47, 0x49, 0x4d,
-  0x50, 0x20, 0x32, 0x2e, 0x31, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x65, 0x74, 0x61,
-  0x64, 0x61, 0x74, 0x61, 0x44, 0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x36, 0x3a, 0x30,
-  0x32, 0x3a, 0x32, 0x30, 0x54, 0x30, 0x37, 0x3a, 0x34, 0x30, 0x3a, 0x30, 0x34, 0x2b, 0x30, 0x31,
-  0x3a, 0x30, 0x30, 0x22, 0x20, 0x78, 0x6d, 0x70, 0x3a, 0x4d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x44,
-  0x61, 0x74, 0x65, 0x3d, 0x22, 0x32, 0x30, 0x32, 0x36, 0x3a, 0x30, 0x32, 0x3a, 0x32, 0x30, 0x54,
-  0x30, 0x37, 0x3a, 0x34, 0x30, 0x3a, 0x30, 0x34, 0x2b, 0x30, 0x31, 0x3a, 0x30, 0x30, 0x22, 0x3e,
-  0x20, 0x3c, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e,
-  0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x72, 0x64, 0x66, 0x3a,
-  0x6c, 0x69, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
-  0x22, 0x73, 0x61, 0x76, 0x65, 0x64, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x63, 0x68,
-  0x61, 0x6e, 0x67, 0x65, 0x64, 0x3d, 0x22, 0x2f, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
-  0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3d, 0x22, 0x78, 0x6d, 0x70, 0x2e,
-  0x69, 0x69, 0x64, 0x3a, 0x33, 0x37, 0x35, 0x35, 0x31, 0x38, 0x65, 0x37, 0x2d, 0x32, 0x65, 0x63,
-  0x32, 0x2d, 0x34, 0x66, 0x64, 0x30, 0x2d, 0x61, 0x31, 0x31, 0x37, 0x2d, 0x63, 0x61, 0x32, 0x66,
-  0x32, 0x65, 0x31, 0x33, 0x31, 0x65, 0x66, 0x62, 0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a,
-  0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x41, 0x67, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x47,
-  0x69, 0x6d, 0x70, 0x20, 0x32, 0x2e, 0x31, 0x30, 0x20, 0x28, 0x4c, 0x69, 0x6e, 0x75, 0x78, 0x29,
-  0x22, 0x20, 0x73, 0x74, 0x45, 0x76, 0x74, 0x3a, 0x77, 0x68, 0x65, 0x6e, 0x3d, 0x22, 0x32, 0x30,
-  0x32, 0x36, 0x2d, 0x30, 0x32, 0x2d, 0x32, 0x30, 0x54, 0x30, 0x37, 0x3a, 0x34, 0x30, 0x3a, 0x30,
-  0x39, 0x2b, 0x30, 0x31, 0x3a, 0x30, 0x30, 0x22, 0x2f, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66,
-  0x3a, 0x53, 0x65, 0x71, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x6d, 0x70, 0x4d, 0x4d, 0x3a, 0x48, 0x69,
-  0x73, 0x74, 0x6f, 0x72, 0x79, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a, 0x44, 0x65, 0x73,
-  0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x20, 0x3c, 0x2f, 0x72, 0x64, 0x66, 0x3a,
-  0x52, 0x44, 0x46, 0x3e, 0x20, 0x3c, 0x2f, 0x78, 0x3a, 0x78, 0x6d, 0x70, 0x6d, 0x65, 0x74, 0x61,
-  0x3e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3c, 0x3f, 0x78, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x3d,
-  0x22, 0x77, 0x22, 0x3f, 0x3e, 0xff, 0xe2, 0x02, 0xb0, 0x49, 0x43, 0x43, 0x5f, 0x50, 0x52, 0x4f,
-  0x46, 0x49, 0x4c, 0x45, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0xa0, 0x6c, 0x63, 0x6d, 0x73, 0x04,
-  0x40, 0x00, 0x00, 0x6d, 0x6e, 0x74, 0x72, 0x52, 0x47, 0x42, 0x20, 0x58, 0x59, 0x5a, 0x20, 0x07,
-  0xea, 0x00, 0x02, 0x00, 0x14, 0x00, 0x06, 0x00, 0x26, 0x00, 0x3b, 0x61, 0x63, 0x73, 0x70, 0x41,
-  0x50, 0x50, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xd6, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x2d, 0x6c, 0x63, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x64, 0x65, 0x73, 0x63, 0x00,
-  0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x40, 0x63, 0x70, 0x72, 0x74, 0x00, 0x00, 0x01, 0x60, 0x00,
-  0x00, 0x00, 0x36, 0x77, 0x74, 0x70, 0x74, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x14, 0x63,
-  0x68, 0x61, 0x64, 0x00, 0x00, 0x01, 0xac, 0x00, 0x00, 0x00, 0x2c, 0x72, 0x58, 0x59, 0x5a, 0x00,
-  0x00, 0x01, 0xd8, 0x00, 0x00, 0x00, 0x14, 0x62, 0x58, 0x59, 0x5a, 0x00, 0x00, 0x01, 0xec, 0x00,
-  0x00, 0x00, 0x14, 0x67, 0x58, 0x59, 0x5a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0x72,
-  0x54, 0x52, 0x43, 0x00, 0x00, 0x02, 0x14, 0x00, 0x00, 0x00, 0x20, 0x67, 0x54, 0x52, 0x43, 0x00,
-  0x00, 0x02, 0x14, 0x00, 0x00, 0x00, 0x20, 0x62, 0x54, 0x52, 0x43, 0x00, 0x00, 0x02, 0x14, 0x00,
-  0x00, 0x00, 0x20, 0x63, 0x68, 0x72, 0x6d, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00, 0x24, 0x64,
-  0x6d, 0x6e, 0x64, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x24, 0x64, 0x6d, 0x64, 0x64, 0x00,
-  0x00, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x24, 0x6d, 0x6c, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x65, 0x6e, 0x55, 0x53, 0x00, 0x00, 0x00, 0x24, 0x00,
-  0x00, 0x00, 0x1c, 0x00, 0x47, 0x00, 0x49, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x20, 0x00, 0x62, 0x00,
-  0x75, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x74, 0x00, 0x2d, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20, 0x00,
-  0x73, 0x00, 0x52, 0x00, 0x47, 0x00, 0x42, 0x6d, 0x6c, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x65, 0x6e, 0x55, 0x53, 0x00, 0x00, 0x00, 0x1a, 0x00,
-  0x00, 0x00, 0x1c, 0x00, 0x50, 0x00, 0x75, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00,
-  0x20, 0x00, 0x44, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x00, 0x58,
-  0x59, 0x5a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xd6, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0xd3, 0x2d, 0x73, 0x66, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x42, 0x00,
-  0x00, 0x05, 0xde, 0xff, 0xff, 0xf3, 0x25, 0x00, 0x00, 0x07, 0x93, 0x00, 0x00, 0xfd, 0x90, 0xff,
-  0xff, 0xfb, 0xa1, 0xff, 0xff, 0xfd, 0xa2, 0x00, 0x00, 0x03, 0xdc, 0x00, 0x00, 0xc0, 0x6e, 0x58,
-  0x59, 0x5a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x38, 0xf5, 0x00,
-  0x00, 0x03, 0x90, 0x58, 0x59, 0x5a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x9f, 0x00,
-  0x00, 0x0f, 0x84, 0x00, 0x00, 0xb6, 0xc4, 0x58, 0x59, 0x5a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x62, 0x97, 0x00, 0x00, 0xb7, 0x87, 0x00, 0x00, 0x18, 0xd9, 0x70, 0x61, 0x72, 0x61, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x00, 0x00, 0xf2, 0xa7, 0x00,
-  0x00, 0x0d, 0x59, 0x00, 0x00, 0x13, 0xd0, 0x00, 0x00, 0x0a, 0x5b, 0x63, 0x68, 0x72, 0x6d, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xd7, 0x00, 0x00, 0x54, 0x7c, 0x00,
-  0x00, 0x4c, 0xcd, 0x00, 0x00, 0x99, 0x9a, 0x00, 0x00, 0x26, 0x67, 0x00, 0x00, 0x0f, 0x5c, 0x6d,
-  0x6c, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x65,
-  0x6e, 0x55, 0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x47, 0x00, 0x49, 0x00,
-  0x4d, 0x00, 0x50, 0x6d, 0x6c, 0x75, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x0c, 0x65, 0x6e, 0x55, 0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00,
-  0x73, 0x00, 0x52, 0x00, 0x47, 0x00, 0x42, 0xff, 0xdb, 0x00, 0x43, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x43,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc2, 0x00, 0x11, 0x08, 0x02, 0x58, 0x03, 0x20, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11,
-  0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xff, 0xc4, 0x00, 0x16,
-  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x10, 0x03, 0x10, 0x00,
-  0x00, 0x01, 0xa3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x92, 0x96, 0x2c, 0x02, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x68, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0xd4, 0x0b, 0x02, 0x50, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x25, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x44, 0x96, 0x90, 0xd4, 0x94, 0xac, 0xe8, 0x0b, 0x00, 0x00, 0x0a, 0x31, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x0d, 0x45, 0x82, 0xa2, 0x2a, 0x0b, 0x0a, 0x58, 0x02, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x40, 0x00, 0x00, 0x00, 0x01, 0x2c,
-  0x96, 0x34, 0x32, 0x68, 0xce, 0xa0, 0xa2, 0xc0, 0x25, 0x04, 0xa0, 0x0c, 0xeb, 0x3a, 0x94, 0x2c,
-  0x00, 0x00, 0x28, 0xc6, 0x80, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x45, 0x80, 0xa2, 0x00, 0x2c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0a, 0x08, 0x05, 0x04, 0x05, 0x04, 0x00, 0x2c, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x19, 0xd2, 0x50, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0a, 0x31, 0xa0, 0x00, 0x00, 0x01, 0x0b, 0x16, 0xc8, 0xb2, 0x82, 0xc0, 0x02, 0x50, 0xb0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x80, 0x50, 0x40, 0x50, 0x40, 0x02, 0xc4, 0x49, 0x69,
-  0x0d, 0x24, 0x34, 0xcd, 0x28, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x8c, 0x68, 0x00, 0x04, 0xab, 0x0b, 0x00, 0x2c, 0x16, 0x0b, 0x16, 0x20, 0xa0, 0xb0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x14, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x03, 0x3a,
-  0x15, 0x29, 0x25, 0x16, 0x4a, 0x8a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x95, 0x64, 0x29, 0x0d, 0x25, 0xb0, 0x0a, 0x31, 0xa0, 0x08, 0xb0, 0x35, 0x05, 0x96, 0x0b, 0x2c,
-  0x5c, 0xd8, 0x35, 0x00, 0xa8, 0x94, 0xa8, 0x82, 0x82, 0xc0, 0x00, 0x01, 0x09, 0x6a, 0x50, 0x2c,
-  0x00, 0x25, 0x00, 0x14, 0x00, 0x01, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x25, 0x14, 0x10, 0x00, 0x94,
-  0x20, 0x00, 0x09, 0x40, 0xa0, 0x40, 0xa0, 0x00, 0xce, 0xa5, 0x95, 0x9d, 0x00, 0xb3, 0x3a, 0x89,
-  0x68, 0xb2, 0xc2, 0x51, 0x48, 0x52, 0x0b, 0x16, 0x59, 0x60, 0x40, 0x52, 0xc0, 0x2c, 0x00, 0x00,
-  0x94, 0x2c, 0x00, 0x49, 0x45, 0x02, 0xc8, 0xb2, 0x5a, 0x2c, 0x00, 0x25, 0x00, 0x14, 0x00, 0x40,
-  0x02, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x22, 0x94, 0x10, 0x00, 0xb0,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x65, 0x96, 0x00, 0x00, 0x2c, 0x02, 0xc5, 0x96, 0x58,
-  0x2c, 0x00, 0x00, 0x00, 0x02, 0x16, 0x50, 0xb0, 0x00, 0x25, 0x89, 0x68, 0xa8, 0x59, 0x62, 0xc4,
-  0xa9, 0x40, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x20, 0x00, 0x25, 0x14, 0x10,
-  0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x25, 0x59, 0x48, 0x10, 0x00, 0xab,
-  0x2c, 0x94, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x52, 0x81, 0x00, 0x01, 0x2a, 0x59, 0x60,
-  0x59, 0x44, 0xb0, 0x59, 0x40, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x00, 0x95,
-  0x41, 0x00, 0x00, 0x04, 0xa5, 0x04, 0x00, 0x28, 0x2c, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x25, 0x59,
-  0x48, 0x2c, 0x00, 0x0b, 0x2c, 0xcd, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x04, 0x95, 0x40, 0x2c, 0x00,
-  0x00, 0x00, 0x4a, 0x96, 0x58, 0x2c, 0xb0, 0x50, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94,
-  0x20, 0x45, 0xa9, 0x49, 0x40, 0x11, 0x29, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2c, 0x00,
-  0x00, 0x02, 0x16, 0x55, 0x82, 0xc0, 0x00, 0xb0, 0x94, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x16, 0x50,
-  0xb0, 0x00, 0x00, 0x00, 0x00, 0x12, 0xa5, 0x81, 0x68, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x41, 0x00, 0x0a, 0x0b, 0x00,
-  0x00, 0x05, 0x96, 0x58, 0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x55, 0x00, 0xb0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4a, 0x94, 0x94, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x22,
-  0x2c, 0x5a, 0x11, 0x28, 0x94, 0x50, 0x40, 0x22, 0x94, 0x10, 0x00, 0x04, 0x5a, 0x10, 0x00, 0x02,
-  0x81, 0x02, 0x80, 0x59, 0x65, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x16, 0x02, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xa5, 0x25, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x42, 0x00, 0x10, 0xa9, 0x40, 0x00, 0x11, 0x68, 0x40, 0x09, 0x54, 0x11, 0x29, 0x41, 0x12, 0xc5,
-  0xa1, 0x22, 0x94, 0x10, 0x35, 0x00, 0x59, 0x65, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16,
-  0x50, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x25, 0xa8, 0x28, 0xb0, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x34, 0x04, 0xa0, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x94, 0x14, 0x54, 0x8a, 0x22, 0x88,
-  0xa2, 0x2c, 0x00, 0x00, 0x52, 0x28, 0x8a, 0x22, 0x88, 0xa2, 0x28, 0x8b, 0x02, 0x89, 0x65, 0x02,
-  0xc0, 0x00, 0x00, 0x00, 0x02, 0x50, 0x80, 0x08, 0x5a, 0x10, 0x00, 0x00, 0x00, 0x04, 0xa2, 0x51,
-  0x41, 0x09, 0x40, 0x00, 0x25, 0x02, 0x82, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x16, 0x54, 0xb0,
-  0xa2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb2, 0x5a, 0x2c, 0x4a, 0x94,
-  0x2c, 0x00, 0x00, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x12, 0xc5, 0xa1, 0x04, 0x5a, 0x10, 0x00,
-  0x00, 0x02, 0x51, 0x41, 0x00, 0x94, 0x50, 0xb9, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b,
-  0x25, 0xa2, 0xc0, 0x08, 0x96, 0xa0, 0xa2, 0xc0, 0x00, 0x11, 0x6a, 0x22, 0xa0, 0xa2, 0x81, 0x00,
-  0x42, 0x5a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x54, 0xa9, 0x65, 0x04, 0xa4, 0x96, 0x55,
-  0x04, 0x00, 0x00, 0x12, 0x94, 0x10, 0x00, 0x00, 0x8b, 0x16, 0x84, 0x00, 0x35, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4b, 0x25, 0xa2, 0xc4, 0xb2, 0x5b, 0x65, 0xcd, 0x67, 0x59, 0xab, 0x34,
-  0x33, 0x65, 0xb0, 0x2c, 0x4b, 0x25, 0xaa, 0xcd, 0x93, 0x52, 0x8a, 0x8c, 0xac, 0xd2, 0x8b, 0x99,
-  0x65, 0x94, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x96, 0x55, 0x04, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0xb2, 0x5a, 0x2c, 0x4b, 0x25, 0xb6, 0x49, 0x6c, 0x0d, 0x32, 0x16, 0x5b, 0x02, 0xc4, 0xb2, 0x5a,
-  0x25, 0x40, 0xa4, 0x16, 0x5b, 0x02, 0xc9, 0x65, 0x94, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x42, 0x00, 0x02, 0x29, 0x41, 0x00, 0x4b, 0x16, 0xa5, 0x40, 0x04, 0x5a, 0x10, 0x00, 0x00,
-  0x0a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x25, 0xa2, 0xc4, 0xb2, 0x5b, 0x65,
-  0xcd, 0x66, 0xaa, 0x88, 0xcd, 0x97, 0x50, 0x2c, 0x09, 0x68, 0xcd, 0x44, 0xad, 0x22, 0x25, 0x97,
-  0x50, 0x41, 0x65, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x54, 0xb2, 0x5a, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x94, 0x10, 0x85, 0xa1, 0x02, 0x82, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x4b, 0x25, 0xa2, 0xc4, 0xa5, 0x8a, 0x88, 0xa0, 0x09, 0x40, 0x2c, 0x4a, 0x96,
-  0x28, 0x8a, 0x22, 0x80, 0xb1, 0x2c, 0x95, 0x40, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x94, 0x00, 0x80, 0x00, 0x96, 0x55, 0x04, 0x00, 0x28, 0x00, 0x02, 0xc0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb2, 0x5a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0xc9, 0x68, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb2,
-  0x6a, 0xa2, 0x2a, 0x0a, 0x2c, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x4b, 0x25, 0xa2, 0xc8, 0x59, 0x62, 0x88, 0xa2, 0x28, 0x8b, 0x16, 0x8b, 0x90,
-  0x00, 0x00, 0x00, 0x12, 0xc9, 0x68, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0xb2, 0x68, 0x20, 0x0a, 0x96, 0xc0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xb2, 0x5a, 0x2c, 0x96, 0x59, 0x42, 0xc0, 0x00, 0x42, 0x5a, 0x2c,
-  0x85, 0xce, 0x8a, 0x8c, 0xad, 0xac, 0xb5, 0x92, 0x8d, 0x65, 0x2c, 0x96, 0x8b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x00, 0x05, 0x96, 0xc0, 0xb0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x2c, 0x00, 0x00, 0x9a, 0x00, 0x2e, 0x40, 0x4b, 0x25, 0xa2,
-  0xc9, 0x65, 0x94, 0x2c, 0x00, 0x09, 0x65, 0x94, 0x2c, 0x9a, 0xcb, 0x3a, 0xd4, 0x82, 0xdc, 0x8b,
-  0x02, 0x8d, 0x65, 0x2c, 0x96, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3b, 0x82, 0xc0, 0xb0, 0x10,
-  0x00, 0x00, 0x09, 0x60, 0x94, 0x00, 0x16, 0x2a, 0x8b, 0x90, 0x94, 0x00, 0xb0, 0x00, 0x02, 0x50,
-  0x02, 0xc0, 0x9a, 0x09, 0x42, 0xc0, 0xb9, 0x01, 0x63, 0x3a, 0x05, 0x0d, 0x60, 0x04, 0x25, 0xa4,
-  0x16, 0x0a, 0x82, 0x8b, 0x00, 0x96, 0x59, 0x42, 0xc9, 0x66, 0xb3, 0xa4, 0xb9, 0x8b, 0x42, 0x0d,
-  0x40, 0xb1, 0x2c, 0x96, 0x8b, 0x00, 0x09, 0x45, 0x9a, 0x80, 0x0b, 0x90, 0x94, 0x28, 0x2e, 0x40,
-  0x05, 0x04, 0x01, 0x2c, 0x94, 0x25, 0x00, 0x00, 0x28, 0xd6, 0x43, 0x3b, 0x00, 0x35, 0x90, 0x40,
-  0x94, 0x26, 0xac, 0x00, 0xb9, 0x00, 0x25, 0x0b, 0x02, 0xc0, 0x03, 0x34, 0x35, 0x00, 0x02, 0x16,
-  0x54, 0xb0, 0x28, 0x8b, 0x0a, 0x2c, 0x4b, 0x25, 0x50, 0x0b, 0x26, 0xb3, 0x73, 0xa4, 0x0a, 0x81,
-  0x65, 0xb0, 0x2c, 0x4b, 0x25, 0xa2, 0xc0, 0x02, 0x50, 0x94, 0x28, 0x10, 0x20, 0x35, 0x00, 0x09,
-  0xa0, 0x94, 0x2c, 0x0b, 0x94, 0x26, 0x82, 0x00, 0x00, 0x0a, 0x35, 0x90, 0x94, 0x25, 0x0b, 0x01,
-  0x02, 0x83, 0x34, 0x28, 0x2c, 0x00, 0x33, 0x42, 0x82, 0xc0, 0x80, 0x94, 0x2c, 0x0a, 0x02, 0x59,
-  0x65, 0x4b, 0x0a, 0x2c, 0x05, 0x04, 0x4b, 0x25, 0xa2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x25,
-  0xa2, 0xc0, 0x00, 0x09, 0x40, 0x00, 0x20, 0x00, 0xa0, 0x94, 0x00, 0xa0, 0xb2, 0x0c, 0xd0, 0x00,
-  0x00, 0x0a, 0x2c, 0x00, 0x20, 0x00, 0xd4, 0x0c, 0xd0, 0x02, 0x82, 0xc0, 0x80, 0x94, 0x01, 0x2c,
-  0xa9, 0x54, 0x20, 0x2c, 0x0a, 0x02, 0x59, 0x65, 0x4b, 0x0a, 0x2c, 0x00, 0x04, 0xb2, 0x5a, 0x2c,
-  0x00, 0x00, 0x00, 0x05, 0x01, 0x08, 0xa2, 0xc0, 0x02, 0x02, 0x50, 0x02, 0x82, 0x02, 0x82, 0x02,
-  0x82, 0xc2, 0x59, 0x42, 0xc8, 0xb3, 0x3a, 0x00, 0x00, 0x00, 0xa8, 0xb2, 0xa0, 0xa8, 0x2a, 0x22,
-  0xa2, 0x96, 0x0a, 0x88, 0xb0, 0x02, 0xa9, 0x12, 0xa1, 0x6c, 0x20, 0x28, 0x00, 0x2a, 0x54, 0x00,
-  0x85, 0x09, 0x40, 0x0a, 0x00, 0x00, 0x80, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x80, 0x01,
-  0x62, 0x16, 0x2a, 0xa0, 0xa8, 0x8a, 0x8a, 0xa8, 0x8a, 0x8a, 0xa8, 0x16, 0x0a, 0x80, 0x14, 0x10,
-  0x25, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x42, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01,
-  0x05, 0x02, 0x6a, 0x67, 0xff, 0xc4, 0x00, 0x1e, 0x11, 0x00, 0x02, 0x01, 0x05, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x40, 0x00, 0x10, 0x20, 0x30,
-  0x50, 0x21, 0x60, 0x80, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01, 0x3f, 0x01, 0xfa, 0x15,
-  0xec, 0x1d, 0x21, 0x0c, 0xef, 0x50, 0x07, 0x48, 0x7a, 0xc3, 0xc1, 0x73, 0x55, 0xd6, 0x03, 0xd1,
-  0xbc, 0x57, 0x8c, 0x5d, 0x38, 0xa6, 0x70, 0x92, 0xf5, 0x89, 0x02, 0xe6, 0x38, 0xc8, 0xd8, 0x4b,
-  0x31, 0x4e, 0x46, 0xc6, 0x08, 0x92, 0x72, 0x3b, 0x86, 0x87, 0x65, 0x05, 0xd3, 0x96, 0x78, 0x03,
-  0x94, 0xe5, 0x18, 0xa7, 0x90, 0xb0, 0x54, 0xb1, 0x33, 0xd5, 0x2c, 0x15, 0x2b, 0x0b, 0x1d, 0xa7,
-  0x7b, 0xc8, 0x6d, 0x3c, 0x11, 0x65, 0xa1, 0xc2, 0x12, 0x1f, 0x49, 0x7d, 0x41, 0xff, 0xc4, 0x00,
-  0x20, 0x11, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x50, 0x00, 0x11, 0x10, 0x20, 0x21, 0x31, 0x30, 0x80, 0x41, 0x60, 0x70, 0xff,
-  0xda, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3f, 0x01, 0xf1, 0x5c, 0xbf, 0xb0, 0xd6, 0x2a, 0x73,
-  0x39, 0x9c, 0xae, 0xb5, 0xfd, 0x4b, 0x5d, 0x52, 0xb4, 0xe9, 0x65, 0x69, 0xd6, 0x6a, 0x5a, 0x8a,
-  0xc1, 0xc1, 0xc8, 0x58, 0x61, 0xc8, 0x5c, 0x74, 0x0b, 0x44, 0x3a, 0x05, 0xc7, 0x4f, 0x95, 0xc5,
-  0x91, 0x64, 0x7d, 0x3c, 0x2b, 0xeb, 0xf1, 0x92, 0xc8, 0xb2, 0x39, 0x0c, 0x69, 0xc9, 0xf7, 0x6b,
-  0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x06, 0x3f, 0x02,
-  0x6a, 0x67, 0xff, 0xc4, 0x00, 0x1f, 0x10, 0x00, 0x02, 0x03, 0x00, 0x01, 0x05, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x10, 0x60, 0x30, 0x20, 0x40, 0x70,
-  0x80, 0xb0, 0x90, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x3f, 0x21, 0xf4, 0x79, 0xdb,
-  0xcf, 0x9a, 0x56, 0xb2, 0x87, 0x48, 0x7a, 0x87, 0xa3, 0x2f, 0x48, 0xa9, 0xe9, 0x15, 0x8e, 0xe9,
-  0xc7, 0x4f, 0x0c, 0x60, 0xee, 0x4d, 0x2f, 0x26, 0x1f, 0x86, 0x02, 0x8a, 0xd6, 0x50, 0x73, 0x18,
-  0x2c, 0xe7, 0x9c, 0x76, 0xe3, 0xc9, 0xae, 0x45, 0x15, 0xa8, 0xb2, 0xc3, 0x80, 0x59, 0x83, 0x30,
-  0x39, 0x5e, 0x61, 0xfe, 0x61, 0x8b, 0x1a, 0x33, 0x07, 0x91, 0x45, 0x18, 0x28, 0xe9, 0x0e, 0x89,
-  0xfc, 0x03, 0xbf, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x10, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xb4, 0xb0, 0x44, 0x04, 0x10, 0x41, 0x04, 0x10, 0x52,
-  0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0x3a, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
-  0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x1f, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x64, 0x07, 0x20,
-  0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x57, 0xf7, 0xcf, 0x3c, 0xf3, 0xcf, 0x0f, 0x88, 0x10, 0x41,
-  0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x79, 0xe6, 0x8a, 0x04, 0x10, 0x41, 0xf7, 0xdf, 0x7d, 0xf7,
-  0xdf, 0x7a, 0xc2, 0x20, 0xcf, 0x76, 0xd0, 0x41, 0x04, 0x10, 0x41, 0x04, 0x17, 0x7c, 0xf3, 0xcf,
-  0x3c, 0xf0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x0b, 0x2e, 0xea, 0x04, 0x10, 0x41, 0x06, 0xa0, 0x41,
-  0x04, 0x1f, 0x7d, 0xf7, 0xdf, 0x7d, 0xe4, 0x29, 0x21, 0x28, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
-  0x10, 0x52, 0x03, 0x5f, 0x1b, 0xf2, 0x36, 0xc1, 0x04, 0x10, 0x41, 0x04, 0x14, 0x41, 0x05, 0x20,
-  0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0xf7, 0xdf, 0x7d, 0xf7, 0x66, 0xc6, 0x04, 0x18, 0x81,
-  0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x0b, 0x7c, 0x77, 0xcc, 0xe2, 0x05, 0xe5, 0xc6, 0x38,
-  0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x1f, 0x7d, 0xf7, 0x44,
-  0x06, 0x0a, 0x22, 0xca, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x11, 0xbc, 0xf3, 0xc3, 0xfb,
-  0x04, 0x10, 0x60, 0x44, 0x0c, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x42, 0x2d,
-  0xf2, 0x41, 0xf7, 0xa8, 0xc1, 0x40, 0x14, 0xc1, 0x04, 0x58, 0xce, 0x04, 0x10, 0x41, 0x74, 0xa0,
-  0x41, 0x7e, 0xff, 0x00, 0x3c, 0xf2, 0xb0, 0x41, 0x04, 0x10, 0x41, 0x00, 0x10, 0x42, 0x08, 0x20,
-  0x8b, 0x00, 0x30, 0x41, 0x06, 0xa4, 0x81, 0x98, 0x1c, 0x02, 0x40, 0x10, 0x0b, 0x4a, 0x00, 0x41,
-  0x07, 0x20, 0x41, 0x1b, 0x90, 0x75, 0x04, 0x14, 0xb7, 0xf3, 0xcb, 0xe2, 0x04, 0x10, 0x41, 0x04,
-  0x10, 0x41, 0x00, 0x20, 0x82, 0x0b, 0x20, 0x82, 0x0c, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x01,
-  0x2a, 0x5a, 0x20, 0x61, 0x04, 0x10, 0x41, 0x04, 0x1e, 0x41, 0x04, 0x1b, 0x40, 0xe3, 0x52, 0x80,
-  0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x20, 0x82, 0x0a, 0x30, 0x82, 0x0c, 0x20, 0x81, 0x04,
-  0x10, 0x41, 0x04, 0x15, 0x40, 0x0e, 0x34, 0x40, 0x04, 0x10, 0x41, 0x04, 0x10, 0x5d, 0x80, 0x10,
-  0x41, 0x4a, 0xda, 0xd6, 0xa8, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x02, 0x08, 0xa0, 0x83,
-  0x08, 0x24, 0x83, 0x08, 0x00, 0x41, 0x04, 0x10, 0x41, 0x00, 0x00, 0x41, 0x04, 0x30, 0x41, 0x04,
-  0x10, 0x41, 0x1a, 0x20, 0x41, 0x04, 0x10, 0x52, 0xb5, 0x68, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10,
-  0x42, 0x08, 0x62, 0xa2, 0x09, 0x20, 0xc2, 0x08, 0x20, 0x83, 0x08, 0x00, 0x41, 0x04, 0x18, 0xc0,
-  0x04, 0x10, 0x5d, 0x04, 0x10, 0x41, 0x04, 0x16, 0x41, 0x04, 0x10, 0x41, 0x04, 0x14, 0xbc, 0x04,
-  0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x00, 0x82, 0x08, 0x20, 0xc2, 0x08, 0x30, 0x82, 0x0a, 0x30,
-  0x82, 0x00, 0x10, 0x41, 0x04, 0x0a, 0xc1, 0x04, 0x10, 0x41, 0x04, 0x10, 0x46, 0x88, 0x10, 0x41,
-  0x04, 0x10, 0x41, 0x05, 0x22, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x40, 0x0b, 0x70, 0x93, 0x88,
-  0x20, 0xb2, 0x08, 0x20, 0x86, 0x08, 0x20, 0x80, 0x0c, 0x10, 0x40, 0xa8, 0x10, 0x41, 0x04, 0x10,
-  0x41, 0x13, 0x90, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x48, 0xa0, 0x41, 0x04, 0x10, 0x41,
-  0x04, 0x20, 0x82, 0x1c, 0xb0, 0x82, 0x18, 0x20, 0x8a, 0x09, 0x20, 0x96, 0x0f, 0x30, 0x81, 0x04,
-  0x0a, 0x81, 0x04, 0x10, 0x41, 0x04, 0x5e, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
-  0x57, 0x3c, 0x10, 0x41, 0x04, 0x10, 0x41, 0x08, 0x24, 0xc3, 0x08, 0x24, 0xc2, 0x08, 0x30, 0x82,
-  0x08, 0x20, 0x82, 0x08, 0x00, 0x41, 0x04, 0x10, 0x41, 0x04, 0x11, 0xbc, 0xe7, 0x3c, 0xf3, 0xdf,
-  0xff, 0x00, 0xfb, 0xcf, 0x3c, 0xf3, 0xcf, 0x5c, 0xeb, 0x04, 0x10, 0x41, 0x04, 0x10, 0x02, 0x08,
-  0xf0, 0x82, 0x08, 0x20, 0x82, 0x4e, 0x20, 0xcb, 0x08, 0x22, 0xc0, 0x04, 0x10, 0x41, 0x04, 0x10,
-  0x41, 0xe5, 0x60, 0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x57, 0x05, 0x30, 0x41,
-  0x04, 0x10, 0x41, 0x00, 0x20, 0x83, 0x09, 0x70, 0x86, 0x0c, 0x30, 0x82, 0x0e, 0x20, 0x83, 0x88,
-  0x30, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x57, 0x04, 0x13, 0x8e, 0x04, 0x10, 0x44, 0x38, 0xe0,
-  0x01, 0x05, 0xd0, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x12, 0x89, 0x3a, 0x82, 0x08, 0x30, 0x92,
-  0x0c, 0x20, 0x82, 0xdc, 0x20, 0x81, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x05, 0x70, 0x56, 0x3c,
-  0x57, 0x6b, 0x05, 0x5f, 0xf1, 0xbf, 0xc0, 0x6b, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x00,
-  0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xa8, 0x20, 0x82, 0x08, 0x10, 0x41, 0x04, 0x10, 0x41,
-  0x04, 0x10, 0x57, 0x05, 0x61, 0x73, 0xc6, 0x10, 0x55, 0xf5, 0xfd, 0x61, 0x06, 0xb0, 0x41, 0x04,
-  0x10, 0x41, 0x04, 0x10, 0x42, 0x08, 0x20, 0xb3, 0x08, 0x25, 0x8b, 0x08, 0x60, 0x82, 0x08, 0x20,
-  0x01, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x05, 0x70, 0x56, 0xdd, 0x93, 0x69, 0x04, 0x1c, 0x4d,
-  0xae, 0xb1, 0xaa, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x17, 0x0c, 0x20, 0x82, 0x08,
-  0x20, 0x92, 0x08, 0xe0, 0x82, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x57, 0x05, 0x0c,
-  0xf3, 0x06, 0x20, 0x52, 0xcf, 0x2c, 0x81, 0x5a, 0x20, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
-  0x04, 0x20, 0x02, 0x08, 0x3a, 0xc2, 0x08, 0x20, 0x82, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04,
-  0x10, 0x41, 0x05, 0x70, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x15, 0xc1, 0x04, 0x10,
-  0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x05, 0x43, 0x8e, 0x00, 0x30, 0x41, 0x04, 0x10, 0x41,
-  0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x57, 0x07, 0x9c, 0xf3, 0xcf, 0x40, 0x41, 0x04,
-  0x10, 0x41, 0x5c, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x54, 0xff, 0x00,
-  0xf2, 0xc1, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41, 0x05, 0x70,
-  0x6b, 0x04, 0x10, 0x5d, 0x07, 0xe2, 0xf5, 0xd8, 0x15, 0xc1, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
-  0x04, 0x10, 0x41, 0x07, 0xff, 0x00, 0xff, 0x00, 0xa4, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
-  0x4f, 0x04, 0x10, 0x44, 0x20, 0x10, 0x57, 0x06, 0xb0, 0x41, 0x06, 0xb0, 0x6e, 0xe5, 0xdd, 0x81,
-  0x5c, 0x10, 0x41, 0x04, 0x10, 0x5a, 0x34, 0x00, 0x41, 0x04, 0x10, 0xbf, 0xff, 0x00, 0xfb, 0x01,
-  0x0c, 0xb0, 0x41, 0x04, 0x72, 0xc1, 0x57, 0xca, 0x41, 0x06, 0xfe, 0x81, 0x05, 0xf1, 0xaf, 0x38,
-  0x10, 0x6b, 0x07, 0xab, 0xf7, 0x84, 0x15, 0xc1, 0x04, 0x26, 0xae, 0x0b, 0xfc, 0x41, 0x04, 0x00,
-  0x41, 0x5f, 0xff, 0x00, 0xff, 0x00, 0xf8, 0x1f, 0xbe, 0x00, 0x10, 0xb6, 0x72, 0x10, 0xbe, 0xac,
-  0x10, 0x7f, 0x04, 0x10, 0x7b, 0x5b, 0x2d, 0x41, 0x5a, 0x20, 0x6a, 0xbb, 0xea, 0x81, 0x5c, 0x10,
-  0x42, 0xde, 0x80, 0xab, 0x04, 0x11, 0x3e, 0x34, 0x17, 0x3f, 0xff, 0x00, 0xff, 0x00, 0xc1, 0x4f,
-  0xe3, 0x0b, 0x07, 0xf0, 0x81, 0x07, 0xf3, 0x09, 0x5f, 0xf2, 0xc1, 0x06, 0xb5, 0xc1, 0x00, 0x15,
-  0xc1, 0x04, 0x10, 0x41, 0x04, 0x15, 0xc1, 0x04, 0x15, 0x28, 0x0b, 0xfe, 0xc6, 0xfb, 0x3c, 0x40,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x21, 0xbf, 0xf4, 0x1f, 0xfd, 0xa0, 0x15, 0xfd, 0xf6,
-  0x76, 0x33, 0x8c, 0x10, 0x6b, 0x5c, 0x10, 0x41, 0x5c, 0x10, 0x41, 0x04, 0x10, 0x00, 0x74, 0x10,
-  0x43, 0xf7, 0xf1, 0x3d, 0xa3, 0xfb, 0x01, 0x2c, 0x1d, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc2,
-  0x3b, 0x8e, 0xc2, 0x83, 0xfe, 0xf0, 0x1c, 0x04, 0xc0, 0x01, 0x02, 0xc3, 0x2b, 0xff, 0x00, 0xfc,
-  0xf3, 0x8c, 0xb0, 0xc3, 0x2c, 0xb2, 0xcb, 0x28, 0xc0, 0xc3, 0x08, 0xe0, 0x00, 0x35, 0x3f, 0x84,
-  0x28, 0x45, 0xe3, 0x1e, 0xf3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x23, 0x11, 0x01, 0x00, 0x02, 0x02, 0x03, 0x00, 0x03, 0x01,
-  0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x10, 0x31, 0x20, 0x21, 0x30,
-  0x40, 0x41, 0x51, 0x61, 0x71, 0x60, 0x80, 0x81, 0xff, 0xda, 0x00, 0x08, 0x01, 0x03, 0x01, 0x01,
-  0x3f, 0x10, 0xf2, 0xa9, 0x4f, 0x80, 0xf9, 0x5c, 0x7e, 0x6a, 0x62, 0xfc, 0x86, 0x77, 0xce, 0xa2,
-  0xfa, 0x07, 0xdb, 0x3a, 0x65, 0x11, 0x2b, 0xd5, 0x6e, 0x5d, 0x4b, 0xfe, 0x4b, 0x3f, 0x27, 0x53,
-  0xaf, 0x1f, 0xfd, 0xf6, 0x37, 0x2e, 0x2d, 0x4d, 0x99, 0xb9, 0xac, 0x3f, 0x5e, 0x8b, 0x70, 0x7e,
-  0x99, 0x5f, 0x92, 0xbc, 0xcd, 0xc6, 0x18, 0xef, 0x0d, 0xcd, 0x79, 0x8f, 0xc0, 0x5a, 0x9b, 0xdb,
-  0x13, 0x37, 0xeb, 0xfe, 0x4e, 0xf1, 0x72, 0xf1, 0x53, 0xa9, 0x52, 0xbe, 0x2a, 0xd4, 0xb7, 0x09,
-  0x50, 0x6a, 0x74, 0xca, 0xaf, 0x30, 0xe1, 0x51, 0xeb, 0xae, 0x17, 0x8b, 0x9f, 0x5e, 0xbd, 0x7d,
-  0xca, 0x19, 0xd7, 0x0b, 0x8b, 0x80, 0xbb, 0xc6, 0xcf, 0xee, 0x6f, 0xf6, 0x57, 0xe4, 0xa7, 0x8d,
-  0x04, 0x4a, 0xc9, 0xa9, 0x5d, 0xf0, 0x79, 0xdf, 0x3a, 0x6a, 0xf9, 0x30, 0xeb, 0x0f, 0xee, 0x2e,
-  0x05, 0xc3, 0x06, 0xf0, 0x75, 0x1f, 0xde, 0x16, 0xe4, 0x2e, 0x58, 0x6b, 0x07, 0x65, 0x67, 0x52,
-  0xce, 0x0f, 0xb6, 0x95, 0xea, 0x37, 0x1d, 0xc3, 0x71, 0xde, 0x0f, 0xc7, 0x9b, 0xd1, 0x5c, 0x36,
-  0x61, 0x6a, 0x5d, 0xfd, 0x47, 0xa6, 0x5b, 0xec, 0xa5, 0x66, 0xaf, 0xc9, 0xd1, 0x36, 0xe0, 0xf8,
-  0x05, 0x77, 0x1e, 0xf8, 0x0d, 0x4a, 0xfb, 0x30, 0x37, 0x1d, 0xfa, 0xda, 0xaf, 0x15, 0x91, 0xa8,
-  0xf6, 0xf8, 0xbb, 0x9b, 0x70, 0x74, 0x73, 0x0b, 0x8b, 0xc8, 0x63, 0x0d, 0xc7, 0x7e, 0x61, 0x6c,
-  0x4a, 0x65, 0xb5, 0x58, 0x1a, 0x3d, 0x77, 0x36, 0xe1, 0xf5, 0xcf, 0x47, 0x80, 0xd4, 0xeb, 0x7f,
-  0x0a, 0x9a, 0xbe, 0x0a, 0x27, 0x81, 0xb8, 0xf8, 0x84, 0x5b, 0xf1, 0x18, 0x9e, 0x62, 0x56, 0x06,
-  0x98, 0xb7, 0x9d, 0x2b, 0x86, 0x97, 0xe0, 0x6e, 0x3b, 0xf0, 0x3b, 0x8f, 0x5d, 0x79, 0x8c, 0x4f,
-  0x30, 0xb8, 0x95, 0x92, 0xd9, 0x68, 0x62, 0xda, 0xac, 0x53, 0xee, 0x3b, 0xea, 0x75, 0x5c, 0x0d,
-  0xc7, 0x7e, 0x1a, 0xf4, 0xa8, 0x5c, 0x4f, 0xcf, 0x21, 0xa8, 0xb7, 0x91, 0x4c, 0xda, 0xf8, 0x3e,
-  0x21, 0x73, 0xad, 0x4b, 0x97, 0xfc, 0x96, 0x7e, 0x4b, 0x3f, 0x27, 0x59, 0x3a, 0x96, 0x7e, 0x4b,
-  0x3f, 0x25, 0xff, 0x00, 0x32, 0x0d, 0xcb, 0xa6, 0x27, 0xdf, 0x90, 0x09, 0xcc, 0xdc, 0x43, 0x84,
-  0x4c, 0xa2, 0x47, 0xc5, 0xeb, 0xa8, 0x6e, 0x3b, 0xf7, 0x0f, 0xef, 0xa1, 0x55, 0x80, 0xb8, 0xf4,
-  0xca, 0x5e, 0x0b, 0x79, 0x6c, 0x7b, 0x29, 0x94, 0xf0, 0xab, 0x94, 0xca, 0x65, 0x64, 0xd7, 0x95,
-  0x2f, 0xb8, 0xd5, 0xf5, 0x0a, 0xbe, 0xe5, 0x3e, 0xb8, 0x8d, 0x71, 0xea, 0xbd, 0xc6, 0xfc, 0x87,
-  0x58, 0x74, 0x7c, 0x42, 0xaf, 0xb9, 0x4f, 0xaf, 0x73, 0x4e, 0x0d, 0xf2, 0x1a, 0xf8, 0x01, 0xc2,
-  0xca, 0xcd, 0x3e, 0xe3, 0x57, 0xd6, 0x29, 0xab, 0xf8, 0x06, 0x9c, 0x1b, 0xe4, 0x35, 0xc4, 0x6e,
-  0x3b, 0xf4, 0xa4, 0x77, 0xce, 0xd5, 0x58, 0xd3, 0xd8, 0xd3, 0x81, 0xac, 0x96, 0x45, 0xbc, 0x0d,
-  0x4b, 0x96, 0xcb, 0x70, 0x6e, 0x3b, 0xf8, 0x06, 0xe2, 0x1c, 0xde, 0x2d, 0xd7, 0xb1, 0xa7, 0xe6,
-  0x0d, 0x4a, 0x95, 0x1f, 0x86, 0x69, 0xc7, 0x44, 0xb3, 0xf2, 0x5f, 0xf3, 0x01, 0xbe, 0x66, 0x9f,
-  0x73, 0x5f, 0x18, 0x69, 0xe4, 0xd1, 0x83, 0x5c, 0x4d, 0x3f, 0x09, 0xf2, 0xdc, 0xb4, 0xaa, 0xc9,
-  0xfa, 0x88, 0xc9, 0xa7, 0x91, 0xd1, 0x83, 0x59, 0x75, 0x83, 0x4f, 0x3d, 0x44, 0x18, 0xf5, 0xc4,
-  0xdf, 0x07, 0x58, 0xb4, 0x69, 0x9d, 0xcf, 0xf5, 0x1f, 0xc4, 0xd4, 0x05, 0x63, 0x4c, 0xec, 0x8b,
-  0x59, 0xfa, 0x86, 0xe2, 0x2b, 0x29, 0xe2, 0x35, 0x97, 0x58, 0x34, 0xe4, 0x2d, 0x9a, 0xc1, 0xd3,
-  0x2c, 0x88, 0xcd, 0x3e, 0x67, 0x6e, 0x06, 0x9e, 0x01, 0x48, 0x31, 0x6f, 0x9f, 0xd4, 0x37, 0x15,
-  0x86, 0x0d, 0xc7, 0x78, 0xfa, 0x96, 0x4b, 0x22, 0xe0, 0xd3, 0x91, 0xa6, 0x59, 0x17, 0xea, 0x11,
-  0xc8, 0xc2, 0x1c, 0x1a, 0xe4, 0x52, 0x5c, 0xac, 0x92, 0xdf, 0xdc, 0x9a, 0x95, 0x83, 0x09, 0x59,
-  0x74, 0x71, 0x1e, 0x06, 0x9e, 0x04, 0x77, 0x96, 0x04, 0xba, 0x96, 0x44, 0x4f, 0xb9, 0x5c, 0x5d,
-  0xf1, 0x30, 0x9c, 0x89, 0x7c, 0x1d, 0x10, 0xd3, 0xc0, 0xd3, 0xca, 0x99, 0x4c, 0xfa, 0xe5, 0x58,
-  0x77, 0x87, 0x0d, 0x0b, 0xc5, 0xd9, 0xc5, 0xe1, 0x5c, 0x6b, 0x95, 0x62, 0xb3, 0x44, 0xa2, 0x75,
-  0x2c, 0x96, 0x4b, 0x25, 0x92, 0xc9, 0x72, 0xe5, 0xcb, 0xf3, 0xa9, 0x6a, 0x54, 0x0b, 0x62, 0x56,
-  0xa5, 0xc6, 0xaa, 0x5f, 0xfc, 0x84, 0x2d, 0x89, 0x5f, 0xf4, 0x1f, 0xff, 0xc4, 0x00, 0x22, 0x11,
-  0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x11, 0x31, 0x10, 0x30, 0x20, 0x21, 0x40, 0x41, 0x51, 0x61, 0x71, 0x80, 0x81, 0xff,
-  0xda, 0x00, 0x08, 0x01, 0x02, 0x01, 0x01, 0x3f, 0x10, 0xd2, 0xa8, 0xfe, 0x19, 0x0d, 0x11, 0xaa,
-  0x05, 0xe6, 0xa6, 0xab, 0x10, 0xbe, 0x6a, 0x7a, 0x27, 0xcc, 0x4a, 0x44, 0x8b, 0xfa, 0x34, 0x99,
-  0x2f, 0x4c, 0x8f, 0xa2, 0x3e, 0x88, 0xfa, 0xf1, 0xd9, 0x1a, 0x16, 0xc4, 0xa1, 0x0d, 0x7b, 0x56,
-  0x7e, 0x90, 0x9a, 0x75, 0xad, 0xe1, 0xe3, 0xac, 0xdf, 0x96, 0x93, 0x67, 0xe1, 0x4f, 0xe8, 0x91,
-  0xe5, 0x24, 0xbc, 0x08, 0x23, 0x3d, 0x92, 0x4f, 0x8a, 0x99, 0x89, 0x3f, 0xa3, 0xe9, 0x09, 0xc8,
-  0xd2, 0x67, 0x76, 0xed, 0x09, 0xa7, 0xad, 0xf0, 0x9d, 0x1e, 0xf7, 0xf7, 0xc2, 0x1b, 0x17, 0xd6,
-  0x1b, 0x86, 0xbe, 0x62, 0xdf, 0x8f, 0x2f, 0xd9, 0x74, 0x74, 0xb4, 0x26, 0x9f, 0x1b, 0x13, 0xd0,
-  0xb5, 0x37, 0xc6, 0x78, 0xac, 0xac, 0x24, 0xfe, 0x8d, 0xc0, 0xd1, 0x11, 0x8a, 0x0a, 0x86, 0xa5,
-  0x0d, 0xeb, 0xe7, 0x08, 0x57, 0x96, 0xc8, 0xc3, 0xeb, 0xbd, 0x0b, 0x4b, 0x7a, 0x13, 0xd3, 0x4f,
-  0xfa, 0x50, 0x5d, 0xa4, 0x3a, 0x65, 0x16, 0x1a, 0xee, 0x57, 0x3b, 0x7c, 0x2b, 0x09, 0x49, 0x02,
-  0x23, 0x54, 0xf8, 0x2a, 0xdb, 0x28, 0x7a, 0x12, 0x81, 0x94, 0xd0, 0xfe, 0x71, 0x64, 0xfa, 0x10,
-  0xe8, 0x55, 0xa9, 0xbd, 0x69, 0xf3, 0xa1, 0x41, 0x66, 0xcd, 0x73, 0x62, 0xe4, 0xc4, 0x3a, 0x15,
-  0x69, 0x7b, 0x93, 0xfb, 0xc5, 0x28, 0x28, 0x2a, 0xd4, 0xb7, 0xa1, 0xa3, 0xf3, 0x53, 0xbd, 0xe9,
-  0xf1, 0xa0, 0xa9, 0x7f, 0x34, 0xb1, 0x69, 0x68, 0x4f, 0x4b, 0xbf, 0x02, 0x59, 0x39, 0xa0, 0xa9,
-  0x7f, 0x34, 0xae, 0xfb, 0xd6, 0xd0, 0x9e, 0x86, 0xbc, 0x25, 0x8a, 0x0a, 0x96, 0x8b, 0xda, 0xc4,
-  0xfe, 0xf9, 0x2b, 0x4c, 0x9f, 0xa4, 0x10, 0x41, 0x0c, 0xec, 0xec, 0xec, 0xec, 0x86, 0x43, 0x20,
-  0x82, 0x06, 0x88, 0xe8, 0x5c, 0xdf, 0x82, 0xb4, 0xd8, 0xc5, 0xb5, 0xe1, 0xae, 0x6f, 0xcb, 0x79,
-  0x92, 0x57, 0x19, 0x44, 0xae, 0x1e, 0xf4, 0xbf, 0x2d, 0xe1, 0xd0, 0xc4, 0x48, 0xb0, 0xc9, 0x67,
-  0xa2, 0x58, 0xbb, 0xc2, 0xbd, 0x4d, 0x79, 0x4f, 0x0e, 0x8e, 0x99, 0x04, 0x0b, 0x0c, 0xe8, 0xe8,
-  0xe8, 0x58, 0x5a, 0x9e, 0xf4, 0xb5, 0xbb, 0xc3, 0xa1, 0x8a, 0xb0, 0xb8, 0x15, 0x09, 0x08, 0x74,
-  0x2a, 0xd6, 0xd6, 0xd4, 0xb6, 0x3b, 0xc3, 0x20, 0x8c, 0x12, 0xc3, 0x44, 0x10, 0x88, 0x58, 0x74,
-  0x2a, 0xd9, 0x04, 0x73, 0x82, 0x11, 0x0b, 0x73, 0xbd, 0xaf, 0x7b, 0xbc, 0xa4, 0x42, 0xf0, 0x9d,
-  0xe3, 0xb6, 0x43, 0x20, 0x81, 0xa8, 0xe6, 0xef, 0x7b, 0xbc, 0xaf, 0x0d, 0xde, 0x17, 0x0f, 0x78,
-  0xe8, 0x48, 0xd8, 0xbb, 0xc3, 0xbf, 0x09, 0x6b, 0x95, 0xc2, 0x44, 0xf2, 0xef, 0x0b, 0x82, 0xbc,
-  0x76, 0x20, 0x6b, 0xf4, 0x4b, 0x0e, 0xf9, 0xc9, 0x3c, 0x9d, 0x70, 0x58, 0x92, 0x78, 0x49, 0x38,
-  0x78, 0x57, 0x96, 0xb8, 0x7b, 0x1d, 0x09, 0x92, 0xb2, 0xb2, 0x43, 0xc9, 0xde, 0x59, 0x38, 0x75,
-  0x88, 0xe4, 0xf4, 0x2c, 0x3c, 0xa2, 0x06, 0x25, 0x9f, 0x7c, 0x3d, 0x8c, 0x81, 0xe1, 0xd0, 0xab,
-  0x0d, 0x49, 0x11, 0x82, 0x58, 0x77, 0x97, 0x84, 0xbd, 0x8e, 0x85, 0x79, 0x78, 0x4f, 0x0f, 0x94,
-  0x61, 0xbf, 0x82, 0xac, 0x3b, 0x23, 0x2e, 0xc9, 0xc3, 0xac, 0x27, 0x39, 0x56, 0x3e, 0x0f, 0x43,
-  0xbe, 0x25, 0x43, 0xa1, 0x0a, 0xc6, 0xe0, 0xed, 0x90, 0x47, 0x35, 0x43, 0x70, 0x37, 0x39, 0x77,
-  0x84, 0xf0, 0xf3, 0x43, 0x20, 0x4a, 0x32, 0xad, 0x8f, 0x83, 0xbd, 0x1e, 0xf2, 0xeb, 0x1d, 0xb1,
-  0xb8, 0xeb, 0x0a, 0xb0, 0x9f, 0xac, 0x4f, 0x39, 0x25, 0x1d, 0x0b, 0xa2, 0x4b, 0x20, 0x5d, 0x12,
-  0x4f, 0x29, 0xc4, 0xf0, 0x96, 0x4b, 0xd7, 0x39, 0x92, 0xc8, 0x3d, 0x41, 0x02, 0xe8, 0x9c, 0x49,
-  0x3f, 0xe6, 0xcf, 0xff, 0xc4, 0x00, 0x25, 0x10, 0x00, 0x03, 0x00, 0x01, 0x04, 0x02, 0x03, 0x01,
-  0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x31, 0x10, 0x20, 0x40, 0x50,
-  0x30, 0x60, 0x21, 0x41, 0x51, 0x71, 0x61, 0x70, 0x81, 0xa0, 0xff, 0xda, 0x00, 0x08, 0x01, 0x01,
-  0x00, 0x01, 0x3f, 0x10, 0xf7, 0x67, 0x9d, 0x62, 0x21, 0x3d, 0x7d, 0xe7, 0x65, 0x65, 0xef, 0xaa,
-  0x3f, 0x81, 0x34, 0xca, 0x91, 0x06, 0x79, 0x90, 0x9d, 0xbd, 0x5f, 0xa5, 0x5f, 0xba, 0x55, 0xbd,
-  0xbe, 0x04, 0xa9, 0x06, 0x18, 0x93, 0x7a, 0x13, 0x8f, 0x96, 0xd9, 0x4b, 0xa4, 0x44, 0x44, 0x21,
-  0x08, 0x4e, 0xb9, 0xbe, 0x84, 0x9b, 0x23, 0x2b, 0x90, 0x8d, 0x9f, 0x28, 0x4e, 0xed, 0x69, 0xb1,
-  0x28, 0xb4, 0x69, 0xb6, 0x2f, 0x8d, 0x1e, 0x7f, 0xef, 0x25, 0xbd, 0xf5, 0x95, 0x95, 0x95, 0x95,
-  0x97, 0xae, 0xc8, 0x58, 0x5a, 0x4f, 0x9d, 0x1e, 0x0c, 0xbc, 0x7f, 0x7f, 0xf7, 0x90, 0xf4, 0x44,
-  0xa4, 0xed, 0xda, 0xbb, 0x96, 0x57, 0x45, 0x76, 0x26, 0x52, 0x13, 0xbb, 0x8b, 0xa1, 0xa7, 0xce,
-  0xea, 0x5e, 0x9e, 0xad, 0x09, 0xf6, 0x4d, 0x88, 0xa4, 0x27, 0x56, 0xd8, 0x95, 0x20, 0x6a, 0x68,
-  0xf9, 0x67, 0xc8, 0x9d, 0xea, 0xe9, 0x76, 0xd2, 0x93, 0xaa, 0xf9, 0x6f, 0x56, 0xa8, 0xbf, 0x5a,
-  0x3c, 0x33, 0x2e, 0x61, 0x56, 0x74, 0x27, 0x7c, 0x74, 0xbb, 0x10, 0xd6, 0xca, 0x64, 0x6b, 0xae,
-  0x6f, 0xa1, 0x3e, 0xf9, 0x2d, 0xf4, 0x25, 0xfa, 0x3f, 0xc6, 0x89, 0x21, 0xa8, 0x27, 0x7c, 0x37,
-  0x64, 0xd5, 0x7c, 0x8d, 0x6d, 0x4c, 0x84, 0xeb, 0x1a, 0x77, 0x95, 0x97, 0xff, 0x00, 0x75, 0x79,
-  0xd7, 0x0f, 0x7d, 0xdc, 0xf5, 0x46, 0x77, 0x52, 0x90, 0x84, 0xf4, 0x34, 0xa3, 0xd6, 0x6c, 0x2c,
-  0x6c, 0x6f, 0x64, 0xd8, 0xb1, 0xb1, 0x0f, 0xc1, 0x46, 0xfc, 0x8b, 0xd1, 0x3e, 0xb4, 0x5b, 0x10,
-  0xf3, 0xb3, 0x3e, 0xb2, 0xb1, 0xa2, 0xc0, 0xf5, 0x43, 0xd8, 0x98, 0xfc, 0xaf, 0x80, 0xb9, 0xeb,
-  0x98, 0xb1, 0xa2, 0x1e, 0xa8, 0x7b, 0x6f, 0x31, 0x8b, 0x9d, 0x37, 0xde, 0x1a, 0xd5, 0x63, 0x56,
-  0xf5, 0x59, 0x1e, 0x38, 0x4b, 0xce, 0xc5, 0xd3, 0x2e, 0x2a, 0xc0, 0xf7, 0x3c, 0x74, 0x2c, 0x5d,
-  0xc3, 0xd5, 0x60, 0x7d, 0x3b, 0x17, 0x39, 0xf2, 0x9e, 0xab, 0x1b, 0xd6, 0x38, 0x0b, 0xd2, 0x9b,
-  0xd5, 0x60, 0x7b, 0x90, 0xf3, 0xe5, 0x7d, 0xfa, 0xe0, 0x2c, 0x0f, 0x3b, 0x90, 0xfd, 0x2e, 0x70,
-  0x56, 0x07, 0x9e, 0x1b, 0xec, 0x1f, 0x40, 0x87, 0x9f, 0x63, 0x43, 0xcf, 0x0d, 0x7a, 0x82, 0x1e,
-  0x7d, 0x3d, 0x71, 0x10, 0xf3, 0xe9, 0x33, 0x6c, 0xe2, 0xa1, 0xfb, 0xe5, 0x29, 0x4a, 0x52, 0x94,
-  0xa5, 0xec, 0x5f, 0x46, 0xbc, 0x10, 0x84, 0x21, 0x08, 0x42, 0x13, 0xa2, 0x7d, 0x8b, 0xf4, 0xe5,
-  0xe9, 0xd3, 0x6a, 0xd6, 0xff, 0x00, 0xa3, 0x6e, 0x94, 0xbe, 0x1a, 0x52, 0x94, 0xbb, 0x98, 0xbd,
-  0x31, 0x89, 0x52, 0x21, 0xe3, 0x48, 0xfc, 0x10, 0x40, 0xd2, 0x82, 0xf9, 0x67, 0xf4, 0x47, 0xa2,
-  0xd5, 0x8b, 0xd3, 0x19, 0x86, 0x8f, 0x0c, 0x59, 0x5e, 0x05, 0x95, 0xae, 0x06, 0x5b, 0x0b, 0xd4,
-  0x18, 0x9c, 0x2a, 0x1b, 0xf8, 0x16, 0x7c, 0x3f, 0xc1, 0xfc, 0x0d, 0xd4, 0x27, 0x08, 0x20, 0x6e,
-  0xfa, 0x8b, 0xd1, 0x1e, 0xcb, 0xba, 0x52, 0x3f, 0xc9, 0xfd, 0x0d, 0x41, 0x2a, 0x7f, 0x43, 0x65,
-  0xea, 0x4c, 0x4f, 0x47, 0x86, 0x64, 0x45, 0xf8, 0x45, 0xbb, 0x2d, 0x70, 0x32, 0xd1, 0xe1, 0xfa,
-  0x93, 0x13, 0xd1, 0xbf, 0xa3, 0x2d, 0x5e, 0x5e, 0xd5, 0x92, 0xaf, 0xd2, 0x8d, 0xa8, 0x2f, 0x87,
-  0xa1, 0xbb, 0xb1, 0x8b, 0xd3, 0x5e, 0xda, 0x2b, 0xf0, 0x42, 0x10, 0x84, 0xd8, 0xc5, 0xea, 0x73,
-  0x80, 0xc5, 0xd1, 0x4f, 0xf7, 0x95, 0x2f, 0xb2, 0x4f, 0x6b, 0x7b, 0x19, 0x92, 0x31, 0xa8, 0x64,
-  0x8f, 0xf0, 0x8d, 0x7a, 0xd3, 0x16, 0xac, 0xc3, 0x47, 0x83, 0x2d, 0x1e, 0x3d, 0x79, 0x8b, 0x1a,
-  0x60, 0x7d, 0xb4, 0x6f, 0xe0, 0x5e, 0xba, 0xca, 0xca, 0xf4, 0x8c, 0x8f, 0xf3, 0x45, 0xc2, 0x7d,
-  0xa2, 0xde, 0xc5, 0xa3, 0x17, 0x91, 0x98, 0x69, 0xf4, 0x30, 0xd4, 0xba, 0xd6, 0xbc, 0x5f, 0x13,
-  0x72, 0x1f, 0x9d, 0x8b, 0x47, 0xa5, 0x29, 0x7c, 0x2c, 0x58, 0xd1, 0xfc, 0xb1, 0x63, 0x4c, 0xbc,
-  0xad, 0x7a, 0x0b, 0x16, 0x8f, 0x48, 0x4d, 0xac, 0x5b, 0x56, 0x10, 0xde, 0x90, 0x55, 0xe9, 0xec,
-  0x5e, 0x26, 0x2d, 0xbf, 0x24, 0xd2, 0x10, 0x9c, 0xb9, 0xc7, 0x7c, 0xc6, 0x2e, 0xc2, 0xf6, 0x6f,
-  0xd9, 0x1f, 0x29, 0x8b, 0xae, 0xa5, 0x13, 0xd9, 0x4a, 0x5d, 0xf4, 0xa5, 0x2a, 0x29, 0x7a, 0x25,
-  0xc4, 0x7c, 0x4b, 0xe1, 0xac, 0xaf, 0x7d, 0x29, 0x50, 0xdf, 0x91, 0xbd, 0xd4, 0xa5, 0x29, 0x78,
-  0xb4, 0xa5, 0x28, 0x99, 0x4a, 0x52, 0x94, 0xa5, 0x28, 0xb6, 0x5d, 0xb4, 0xa5, 0xe6, 0x52, 0xf9,
-  0x29, 0x4a, 0x5e, 0xba, 0x95, 0xff, 0x00, 0xe4, 0xe7, 0xff, 0xd9
-};
-const unsigned int FILE_IMG2_JPG_len = 10091;
@@ -0,0 +1,162 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "lba_trace.h"
+
+_Static_assert(sizeof(struct lba_trace_entry) == 16, "trace entries are exported as they are");
+
+#if LBA_TRACE_ENTRIES > 0
+static struct lba_trace_entry trace[LBA_TRACE_ENTRIES];
+#endif
+static uint32_t trace_end;      // entries recorded, only the writer moves it forward
+static uint32_t trace_start;    // entries before it were cleared
+static bool trace_on = true;
+
+
+void lba_trace_record(uint32_t t_us, enum lba_trace_op op, uint32_t lba, uint32_t offset, uint32_t bufsize, uint32_t result)
+{
+#if LBA_TRACE_ENTRIES > 0
+    if (!__atomic_load_n(&trace_on, __ATOMIC_RELAXED))
+    {
+        return;
+    }
+    const uint32_t seq = __atomic_load_n(&trace_end, __ATOMIC_RELAXED);
+    struct lba_trace_entry * e = &trace[seq & (LBA_TRACE_ENTRIES - 1)];
+    e->t_us = t_us;
+    e->lba = lba;
+    e->bufsize = (uint16_t)bufsize;
+    e->offset = (uint16_t)offset;
+    e->result = (uint16_t)result;
+    e->op = (uint8_t)op;
+    e->reserved = 0;
+    // Entry first, then the end that makes it visible
+    __atomic_store_n(&trace_end, seq + 1, __ATOMIC_RELEASE);
+#else
+    (void)t_us; (void)op; (void)lba; (void)offset; (void)bufsize; (void)result;
+#endif
+}
+
+
+uint32_t lba_trace_end(void)
+{
+    return __atomic_load_n(&trace_end, __ATOMIC_ACQUIRE);
+}
+
+
+// Oldest entry still in the ring, for a ring that ends at end. The slot of entry end - LBA_TRACE_ENTRIES
+// is where the next record goes, it may be half overwritten
+static uint32_t trace_first(uint32_t end)
+{
+    const uint32_t start = __atomic_load_n(&trace_start, __ATOMIC_RELAXED);
+    const uint32_t oldest = (end >= LBA_TRACE_ENTRIES) ? (end - LBA_TRACE_ENTRIES + 1) : 0;
+    return (start - oldest <= end - oldest) ? start : oldest;
+}
+
+
+bool lba_trace_get(uint32_t seq, struct lba_trace_entry * entry)
+{
+#if LBA_TRACE_ENTRIES > 0
+    const uint32_t end = lba_trace_end();
+    const uint32_t first = trace_first(end);
+    if ((seq - first) >= (end - first))
+    {
+        return false;
+    }
+    memcpy(entry, &trace[seq & (LBA_TRACE_ENTRIES - 1)], sizeof(*entry));
+    // The writer may have wrapped around meanwhile and be overwriting it: it writes entry number end
+    // (the slot of seq + LBA_TRACE_ENTRIES at the earliest) before moving end past it
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (lba_trace_end() - seq) < LBA_TRACE_ENTRIES;
+#else
+    (void)seq; (void)entry;
+    return false;
+#endif
+}
+
+
+void lba_trace_clear(void)
+{
+    __atomic_store_n(&trace_start, lba_trace_end(), __ATOMIC_RELAXED);
+}
+
+
+void lba_trace_enable(bool on)
+{
+    __atomic_store_n(&trace_on, on, __ATOMIC_SEQ_CST);
+}
+
+
+bool lba_trace_enabled(void)
+{
+    return __atomic_load_n(&trace_on, __ATOMIC_SEQ_CST);
+}
+
+
+// Hex lines of 32 bytes, the last one flushed by a call with len 0
+struct hex_out
+{
+    void (* emit)(const char * line, void * ctx);
+    void * ctx;
+    char line[2 * 32 + 1];
+    uint32_t used;
+};
+
+
+static void hex_put(struct hex_out * out, const void * data, uint32_t len)
+{
+    static const char HEX[] = "0123456789abcdef";
+    const uint8_t * p = (const uint8_t *)data;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        out->line[out->used++] = HEX[p[i] >> 4];
+        out->line[out->used++] = HEX[p[i] & 15];
+        if (out->used == sizeof(out->line) - 1)
+        {
+            out->line[out->used] = '\0';
+            out->emit(out->line, out->ctx);
+            out->used = 0;
+        }
+    }
+    if ((len == 0) && (out->used > 0))
+    {
+        out->line[out->used] = '\0';
+        out->emit(out->line, out->ctx);
+        out->used = 0;
+    }
+}
+
+
+uint32_t lba_trace_export(void (* emit)(const char * line, void * ctx), void * ctx)
+{
+    const bool was_on = lba_trace_enabled();
+    lba_trace_enable(false);
+    // A record already under way can still overwrite the oldest entry: lba_trace_get notices,
+    // it goes out as zeros (bufsize 0)
+    const uint32_t end = lba_trace_end();
+    const uint32_t first = trace_first(end);
+
+    struct lba_trace_header header;
+    memcpy(header.magic, LBA_TRACE_MAGIC, sizeof(header.magic));
+    header.version = LBA_TRACE_VERSION;
+    header.entry_size = sizeof(struct lba_trace_entry);
+    header.count = end - first;
+    header.first = first;
+
+    struct hex_out out = { emit, ctx, { 0 }, 0 };
+    emit(LBA_TRACE_BEGIN, ctx);
+    hex_put(&out, &header, sizeof(header));
+    for (uint32_t seq = first; seq != end; seq++)
+    {
+        struct lba_trace_entry e;
+        if (!lba_trace_get(seq, &e))
+        {
+            memset(&e, 0, sizeof(e));
+        }
+        hex_put(&out, &e, sizeof(e));
+    }
+    hex_put(&out, NULL, 0);
+    emit(LBA_TRACE_END, ctx);
+
+    lba_trace_enable(was_on);
+    return end - first;
+}
@@ -0,0 +1,100 @@
+#include "led_status.h"
+#include <Arduino.h>
+#include <FastLED.h>
+
+#define LED_DI_PIN  40
+#define LED_CI_PIN  39
+// Same priority as loop(), time sliced with it: loop() never blocks, anything lower on its core starves
+#define LED_TASK_STACK      2048
+#define LED_TASK_PRIORITY   1
+#define LED_TASK_CORE       1
+#define LED_ERROR_MS        3000
+#define LED_BLINK_MS        125
+#define LED_BREATHE_MS      1000
+#define LED_FETCH_MIN       32      // brightness (of 255) at the start of a download
+#define FETCH_UNKNOWN       1002
+
+static CRGB leds[1];
+
+// Written by any task, read by the LED task
+static uint32_t host_state = LED_IDLE;
+static uint32_t fetch_permille;     // 1 + progress in 1/1000, 0: no download, FETCH_UNKNOWN: size unknown
+static uint32_t error_at;           // millis() | 1 of the last failed download, 0: none
+
+static const CRGB::HTMLColorCode COLOUR[LED_STATES] =
+{
+    CRGB::Red, CRGB::Yellow, CRGB::Green, CRGB::Blue, CRGB::Purple, CRGB::Orange, CRGB::Red,
+};
+
+void led_status_set(enum led_state state)
+{
+    __atomic_store_n(&host_state, (uint32_t)state, __ATOMIC_RELAXED);
+}
+
+void led_status_fetch(uint32_t done, uint32_t total)
+{
+    const uint32_t permille = (total == 0) ? FETCH_UNKNOWN : 1 + (uint32_t)((uint64_t)min(done, total) * 1000 / total);
+    __atomic_store_n(&fetch_permille, permille, __ATOMIC_RELAXED);
+}
+
+void led_status_fetch_end(bool ok)
+{
+    __atomic_store_n(&error_at, ok ? 0 : (millis() | 1), __ATOMIC_RELAXED);
+    __atomic_store_n(&fetch_permille, 0, __ATOMIC_RELAXED);
+}
+
+// Colour of the current state at time now
+static CRGB frame(uint32_t now)
+{
+    const uint32_t host = __atomic_load_n(&host_state, __ATOMIC_RELAXED);
+    const uint32_t permille = __atomic_load_n(&fetch_permille, __ATOMIC_RELAXED);
+    const uint32_t error = __atomic_load_n(&error_at, __ATOMIC_RELAXED);
+
+    if (host == LED_MEDIA_AWAY)
+    {
+        return COLOUR[LED_MEDIA_AWAY];
+    }
+    if ((error != 0) && (now - error < LED_ERROR_MS))
+    {
+        return ((now / LED_BLINK_MS) % 2) ? CRGB(CRGB::Black) : COLOUR[LED_ERROR];
+    }
+    if (permille != 0)
+    {
+        uint32_t level;
+        if (permille == FETCH_UNKNOWN)
+        {
+            const uint32_t phase = now % LED_BREATHE_MS;
+            level = 2 * 255 * min(phase, LED_BREATHE_MS - phase) / LED_BREATHE_MS;
+        }
+        else
+        {
+            level = (permille - 1) * 255 / 1000;
+        }
+        return CRGB(COLOUR[LED_FETCHING]).nscale8(max(level, (uint32_t)LED_FETCH_MIN));
+    }
+    return COLOUR[min(host, (uint32_t)(LED_STATES - 1))];
+}
+
+static void led_task(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        const CRGB colour = frame(millis());
+        if (colour != leds[0])
+        {
+            leds[0] = colour;
+            FastLED.show();
+        }
+        vTaskDelay(pdMS_TO_TICKS(LED_FRAME_MS));
+    }
+}
+
+void led_status_begin(void)
+{
+    FastLED.addLeds<APA102, LED_DI_PIN, LED_CI_PIN, BGR>(leds, 1);  // BGR ordering is typical
+    FastLED.setBrightness(25);
+    leds[0] = COLOUR[LED_IDLE];
+    FastLED.show();
+    xTaskCreatePinnedToCore(led_task, "led", LED_TASK_STACK, NULL, LED_TASK_PRIORITY, NULL, LED_TASK_CORE);
+}
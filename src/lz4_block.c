@@ -0,0 +1,211 @@
+#include <stdint.h>
+#include <string.h>
+#include "lz4_block.h"
+
+// A sequence is a token (literal length << 4 | match length - 4), the literals, a 16 bit match offset
+// and the match length beyond 15. The last sequence of a block holds literals only
+#define MIN_MATCH       4
+#define LAST_LITERALS   5       // a block always ends in at least this many literals
+#define MATCH_LIMIT     12      // no match starts within this many bytes of the end
+#define MAX_OFFSET      65535
+#define HASH_BITS       11      // 4 kB of table, plenty for 4 kB blocks
+
+
+static uint32_t read32(const uint8_t * p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+
+static uint32_t hash4(uint32_t v)
+{
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+
+// Bytes a sequence takes at most
+static uint32_t sequence_size(uint32_t literals, uint32_t match)
+{
+    return 1 + literals / 255 + 1 + literals + 2 + match / 255 + 1;
+}
+
+
+// Length beyond the 15 that fit the token: 255 per byte, ends with a byte below 255
+static uint8_t * put_length(uint8_t * op, uint32_t n)
+{
+    while (n >= 255)
+    {
+        *op++ = 255;
+        n -= 255;
+    }
+    *op++ = (uint8_t)n;
+    return op;
+}
+
+
+static uint8_t * put_sequence(uint8_t * op, const uint8_t * literals, uint32_t num_literals, uint32_t offset, uint32_t match)
+{
+    uint8_t * token = op++;
+    *token = (uint8_t)(((num_literals < 15) ? num_literals : 15) << 4);
+    if (num_literals >= 15)
+    {
+        op = put_length(op, num_literals - 15);
+    }
+    memcpy(op, literals, num_literals);
+    op += num_literals;
+    if (offset == 0)
+    {
+        return op;      // last sequence
+    }
+    *op++ = (uint8_t)offset;
+    *op++ = (uint8_t)(offset >> 8);
+    match -= MIN_MATCH;
+    *token |= (uint8_t)((match < 15) ? match : 15);
+    if (match >= 15)
+    {
+        op = put_length(op, match - 15);
+    }
+    return op;
+}
+
+
+uint32_t lz4_block_compress(const uint8_t * src, uint32_t len, uint8_t * dst, uint32_t cap)
+{
+    static uint16_t table[1 << HASH_BITS];     // last position of each hashed 4 byte sequence
+    const uint8_t * const end = src + len;
+    const uint8_t * ip = src;
+    const uint8_t * anchor = src;               // first literal not emitted yet
+    uint8_t * op = dst;
+
+    if (len > 0xFFFF)
+    {
+        return 0;
+    }
+    memset(table, 0, sizeof(table));
+    while ((len >= MATCH_LIMIT) && (ip <= end - MATCH_LIMIT))
+    {
+        const uint32_t h = hash4(read32(ip));
+        const uint8_t * ref = src + table[h];
+        table[h] = (uint16_t)(ip - src);
+        if ((ref >= ip) || (ip - ref > MAX_OFFSET) || (read32(ref) != read32(ip)))
+        {
+            ip++;
+            continue;
+        }
+
+        const uint8_t * m = ip + MIN_MATCH;
+        while ((m < end - LAST_LITERALS) && (*m == ref[m - ip]))
+        {
+            m++;
+        }
+        const uint32_t literals = ip - anchor;
+        const uint32_t match = m - ip;
+        if (sequence_size(literals, match) > cap - (uint32_t)(op - dst))
+        {
+            return 0;
+        }
+        op = put_sequence(op, anchor, literals, ip - ref, match);
+        ip = m;
+        anchor = ip;
+    }
+
+    const uint32_t literals = end - anchor;
+    if (sequence_size(literals, 0) - 3 > cap - (uint32_t)(op - dst))
+    {
+        return 0;
+    }
+    op = put_sequence(op, anchor, literals, 0, 0);
+    return op - dst;
+}
+
+
+// Length beyond 15, 0xFFFFFFFF if the input ends within it
+static uint32_t get_length(const uint8_t ** ip, const uint8_t * end)
+{
+    uint32_t n = 0;
+    uint8_t b;
+    do
+    {
+        if (*ip >= end)
+        {
+            return 0xFFFFFFFF;
+        }
+        b = *(*ip)++;
+        n += b;
+    } while (b == 255);
+    return n;
+}
+
+
+uint32_t lz4_block_decompress(const uint8_t * src, uint32_t len, uint8_t * dst, uint32_t cap)
+{
+    const uint8_t * ip = src;
+    const uint8_t * const end = src + len;
+    uint8_t * op = dst;
+    uint8_t * const op_end = dst + cap;
+
+    while (ip < end)
+    {
+        const uint8_t token = *ip++;
+        uint32_t literals = token >> 4;
+        if (literals == 15)
+        {
+            const uint32_t more = get_length(&ip, end);
+            if (more == 0xFFFFFFFF)
+            {
+                return 0;
+            }
+            literals += more;
+        }
+        if ((literals > (uint32_t)(end - ip)) || (literals > (uint32_t)(op_end - op)))
+        {
+            return 0;
+        }
+        memcpy(op, ip, literals);
+        op += literals;
+        ip += literals;
+        if (ip == end)
+        {
+            break;      // last sequence
+        }
+
+        if (end - ip < 2)
+        {
+            return 0;
+        }
+        const uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        uint32_t match = token & 15;
+        if (match == 15)
+        {
+            const uint32_t more = get_length(&ip, end);
+            if (more == 0xFFFFFFFF)
+            {
+                return 0;
+            }
+            match += more;
+        }
+        match += MIN_MATCH;
+        if ((offset == 0) || (offset > (uint32_t)(op - dst)) || (match > (uint32_t)(op_end - op)))
+        {
+            return 0;
+        }
+        const uint8_t * ref = op - offset;
+        if (offset >= match)
+        {
+            memcpy(op, ref, match);
+            op += match;
+        }
+        else
+        {
+            // Overlapping match repeats the last offset bytes (runs of a single byte for offset 1)
+            while (match-- > 0)
+            {
+                *op++ = *ref++;
+            }
+        }
+    }
+    return op - dst;
+}
@@ -19,17 +19,13 @@ void loop() {}
 #error This sketch requires ESP32 Arduino Core version 3.3.0 or later
 #endif
 
-#include <FastLED.h>
 #include <WiFi.h>
 #include "USB.h"
 #include "usb_msc.h"
 #include "cli.h"
 #include "credentials.h"
 #include "http_client.h"
-
-#define LED_DI_PIN  40
-#define LED_CI_PIN  39
-CRGB leds[1];
+#include "led_status.h"
 
 
 void wifi_connect(void)
@@ -61,23 +57,65 @@ void wifi_status(char *buf, size_t len)
 }
 
 
+// Time between loop() passes, the CLI's and the LED's worst case response time
+static uint32_t loop_passes;
+static uint32_t loop_gap_sum_us;
+static uint32_t loop_gap_max_us;
+
+static void loop_measure(void)
+{
+    static uint32_t t_prev;
+    const uint32_t now = micros();
+    if (t_prev != 0)
+    {
+        const uint32_t gap = now - t_prev;
+        loop_passes++;
+        loop_gap_sum_us += gap;
+        loop_gap_max_us = max(loop_gap_max_us, gap);
+    }
+    t_prev = now;
+}
+
+// Stats since the last call
+void loop_status(char *buf, size_t len)
+{
+    snprintf(buf, len, "%u passes, gap avg %u us, max %u us", loop_passes,
+             loop_passes ? loop_gap_sum_us / loop_passes : 0, loop_gap_max_us);
+    loop_passes = 0;
+    loop_gap_sum_us = 0;
+    loop_gap_max_us = 0;
+}
+
+
+void load_profile(void)
+{
+    char profile[16];
+    creds_get_profile(profile, sizeof(profile));
+    if ((profile[0] != '\0') && !usb_msc_set_profile(profile))
+    {
+        Serial.printf("USB: unknown frame profile \"%s\"\n", profile);
+    }
+}
+
+
 void setup()
 {
     Serial.begin(115200);
 
-    FastLED.addLeds<APA102, LED_DI_PIN, LED_CI_PIN, BGR>(leds, 1);  // BGR ordering is typical
-    FastLED.setBrightness(25);
-    leds[0] = CRGB::Red;
-    FastLED.show();
+    led_status_begin();
 
     usb_msc_begin();
+    http_client_begin();    // cached images into the slots before the host looks
     USB.begin();
     cli_begin();
+    load_profile();
     wifi_connect();
 }
 
 void loop()
 {
+    loop_measure();
+
     static bool wifi_connected;
     const bool connected = (WiFi.status() == WL_CONNECTED);
     if (connected != wifi_connected)
@@ -94,7 +132,17 @@ void loop()
     wifi_connected = connected;
 
     cli_process();
+#if !HTTP_FETCH_TASK
     http_client_process();
+#endif
+    struct http_result r;
+    while (http_client_result(&r))
+    {
+        static const char * const SOURCE[] = { "server", "cache", "fallback", "nowhere", "server, unchanged", "server, too big" };
+        Serial.printf("Fetch: IMG%u.JPG from %s, %u bytes in %u ms\n", r.slot + 1,
+                      SOURCE[min(r.source, (uint32_t)HTTP_OVERSIZE)], r.bytes, r.ms);
+    }
+    usb_msc_process();
 }
 
 
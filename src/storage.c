@@ -1,111 +1,160 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
-#include <Arduino.h>
-
-#define DISK_SECTOR_SIZE (512)
-
-extern const unsigned char DISK_MBR[];
-extern const unsigned int DISK_MBR_len;
-extern const unsigned char DISK_VBR[];
-extern const unsigned int DISK_VBR_len;
-extern const unsigned char DISK_FAT[];
-extern const unsigned int DISK_FAT_len;
-extern const unsigned char DISK_ROOTDIR[];
-extern const unsigned int DISK_ROOTDIR_len;
-
-extern const unsigned char FILE_IMG1_JPG[];
-extern const unsigned int FILE_IMG1_JPG_len;
-extern const unsigned char FILE_IMG2_JPG[];
-extern const unsigned int FILE_IMG2_JPG_len;
-
-// CREDS.JSN
-// @LBA 2152 (0x0010d000)
-// Total size is 2kB (4 sectors, resp. 1 clusters), fill up the rest with zeros
-// Cluster 3
+#include <stdbool.h>
+#include "storage.h"
+#include "lz4_block.h"
+#include "fallback.h"
+
+// File data, mapped into the volume by volume.cpp
 unsigned char FILE_CREDS_JSN[4 * DISK_SECTOR_SIZE]; // 2kB
-unsigned char FILE_IMG_JPG[256 * DISK_SECTOR_SIZE]; // 128kB
-unsigned int  FILE_IMG_JPG_len; // actual fetched size, read by storage.c
 
-// extern volatile uint32_t http_fetch_trigger;
+// Image buffers. Every slot (IMG1.JPG, IMG2.JPG, ...) serves its own front buffer.
+// Downloads go to a buffer no slot serves if there is one (the spare), the slot is then
+// switched over by swapping its front pointer. Otherwise the slot's buffer is refilled in place
+static unsigned char image_mem[STORAGE_IMG_SLOTS][STORAGE_IMG_SIZE];
+#if STORAGE_IMG_BACK_SIZE > 0
+static unsigned char image_mem_spare[STORAGE_IMG_BACK_SIZE];
+#define NUM_IMAGE_BUFS (STORAGE_IMG_SLOTS + 1)
+#else
+#define NUM_IMAGE_BUFS (STORAGE_IMG_SLOTS)
+#endif
+static struct image_buf image_bufs[NUM_IMAGE_BUFS];
+static struct image_buf image_mapped[STORAGE_IMG_SLOTS][2];   // read-only fronts into mapped flash, two per slot to swap between
+
+static struct image_buf * image_front[STORAGE_IMG_SLOTS];   // what the host reads, per slot
+static struct image_buf * image_reading;                    // what the USB read path is copying from right now
+
+// Ring bookkeeping: slot states and cursor are written by both the USB read path and the fetch loop
+static uint8_t image_state[STORAGE_IMG_SLOTS];              // enum image_state
+static uint8_t image_state_before[STORAGE_IMG_SLOTS];       // state to return to if a download fails
+static int32_t ring_cursor = -1;
+static void (* publish_hook)(uint32_t slot);                // told whenever what a slot serves changes
+static uint32_t ring_hits;
+static uint32_t ring_misses;
+
+// Image being written into a buffer, one at a time (the fetch loop)
+static struct image_buf * fill_buf;
+static uint32_t fill_len;                   // bytes appended
 
+#if STORAGE_IMG_PACKED
+// Packed buffer: the blocks one after the other from the start of the buffer, compressed or as they are.
+// The index grows down from the end of the buffer, one entry per block: where its bytes end,
+// PACKED_RAW set if stored as is
+#define PACKED_RAW 0x80000000u
+static unsigned char fill_block[STORAGE_IMG_BLOCK];     // block being appended, packed once full
+static uint32_t fill_used;                  // packed bytes at the start of the buffer
+static uint32_t fill_blocks;                // blocks packed
 
-static void * get_file_lba(uint32_t offset, void * buffer, const unsigned char data[], uint32_t len)
+// Blocks the USB read path unpacked last, replaced round robin
+static struct
 {
-    const int32_t rest = len - offset;
-    // Entiere sector of data left
-    if (rest >= DISK_SECTOR_SIZE)
-    {
-        memcpy(buffer, &data[offset], DISK_SECTOR_SIZE);
-        return buffer;
-    }
-    // Some data left
-    if (rest > 0)
+    const struct image_buf * buf;
+    uint32_t gen;
+    uint32_t block;
+    unsigned char data[STORAGE_IMG_BLOCK];
+} block_cache[STORAGE_IMG_BLOCK_CACHE];
+static uint32_t block_cache_next;
+#endif
+
+
+// Default extent reader: copy backing bytes, zero fill beyond their end
+static uint32_t read_extent_data(const struct lba_extent * ext, uint32_t offset, void * buffer, uint32_t bufsize)
+{
+    uint32_t rest = (offset < ext->len) ? (ext->len - offset) : 0;
+    if (rest > bufsize)
     {
-        memcpy(buffer, &data[offset], rest);
-        memset(buffer + rest, 0, DISK_SECTOR_SIZE - rest);
-        return buffer;
+        rest = bufsize;
     }
-    // Clear entire sectory
-    memset(buffer, 0, DISK_SECTOR_SIZE);
-    return buffer;
+    memcpy(buffer, &ext->data[offset], rest);
+    memset(buffer + rest, 0, bufsize - rest);
+    return bufsize;
 }
 
 
-// Read 512 bytes from storage at given LBA into buffer
-// Set buffer to zeros, if LBA address is "unknown"
-static void * get_lba(uint32_t lba, void * buffer)
+// Index of the last extent hit, sequential reads mostly stay within it
+static uint32_t extent_cache;
+
+
+// Find the first extent ending after lba (the one containing lba, or the next one up)
+// Returns DISK_EXTENTS_NUM if there is none
+static uint32_t find_extent(uint32_t lba)
 {
-    if (lba == 0)
-    {
-        memcpy(buffer, DISK_MBR, DISK_SECTOR_SIZE);
-        return buffer;
-    }
-    if (lba == 2048)
-    {
-        memcpy(buffer, DISK_VBR, DISK_SECTOR_SIZE);
-        return buffer;
-    }
-    if ((lba == 2052) || (lba == 2084))
-    {
-        memcpy(buffer, DISK_FAT, DISK_SECTOR_SIZE);
-        return buffer;
-    }
-    if (lba == 2116)
-    {
-        memcpy(buffer, DISK_ROOTDIR, DISK_SECTOR_SIZE);
-        return buffer;
-    }
-    if ((lba >= 2152) && (lba < 2156))
+    const struct lba_extent * ext = &DISK_EXTENTS[extent_cache];
+    if ((lba >= ext->lba) && (lba < ext->lba + ext->count))
     {
-        return get_file_lba(DISK_SECTOR_SIZE * (lba - 2152), buffer, FILE_CREDS_JSN, sizeof(FILE_CREDS_JSN));
+        return extent_cache;
     }
-    if ((lba >= 2156) && (lba < 2412))
+
+    uint32_t lo = 0;
+    uint32_t hi = DISK_EXTENTS_NUM;
+    while (lo < hi)
     {
-        // return get_file_lba(DISK_SECTOR_SIZE * (lba - 2412), buffer, FILE_IMG1_JPG, FILE_IMG1_JPG_len);
-        return get_file_lba(DISK_SECTOR_SIZE * (lba - 2156), buffer, FILE_IMG_JPG, sizeof(FILE_IMG_JPG));
+        const uint32_t mid = (lo + hi) / 2;
+        if (DISK_EXTENTS[mid].lba + DISK_EXTENTS[mid].count <= lba)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
     }
-    if ((lba >= 2412) && (lba < 2668))
+    if ((lo < DISK_EXTENTS_NUM) && (lba >= DISK_EXTENTS[lo].lba))
     {
-        // return get_file_lba(DISK_SECTOR_SIZE * (lba - 2412), buffer, FILE_IMG2_JPG, FILE_IMG2_JPG_len);
-        return get_file_lba(DISK_SECTOR_SIZE * (lba - 2412), buffer, FILE_IMG_JPG, sizeof(FILE_IMG_JPG));
+        extent_cache = lo;
     }
-
-    // Otherwise
-    memset(buffer, 0, DISK_SECTOR_SIZE);
-    return buffer;
+    return lo;
 }
 
 
 // bufsize is expected to be a multiple of DISK_SECTOR_SIZE
+// Each extent touched is served with a single copy
+// Returns less than bufsize if sectors of a streamed image are not there yet
 uint32_t get_lba_slice(uint32_t lba, void * buffer, uint32_t bufsize)
 {
-    int32_t num = (int32_t)bufsize;
+    uint32_t num = bufsize / DISK_SECTOR_SIZE;
     while (num > 0)
     {
-        get_lba(lba++, buffer);
-        buffer += DISK_SECTOR_SIZE;
-        num -= DISK_SECTOR_SIZE;
+        const uint32_t idx = find_extent(lba);
+        // Gap in the LBA map, zero fill up to the next extent
+        if ((idx >= DISK_EXTENTS_NUM) || (lba < DISK_EXTENTS[idx].lba))
+        {
+            uint32_t n = num;
+            if ((idx < DISK_EXTENTS_NUM) && (DISK_EXTENTS[idx].lba - lba < n))
+            {
+                n = DISK_EXTENTS[idx].lba - lba;
+            }
+            memset(buffer, 0, n * DISK_SECTOR_SIZE);
+            lba += n;
+            buffer += n * DISK_SECTOR_SIZE;
+            num -= n;
+            continue;
+        }
+
+        const struct lba_extent * ext = &DISK_EXTENTS[idx];
+        uint32_t n = ext->lba + ext->count - lba;
+        if (n > num)
+        {
+            n = num;
+        }
+        const uint32_t offset = DISK_SECTOR_SIZE * (lba - ext->lba);
+        if (ext->read != NULL)
+        {
+            // Short read: the rest has not arrived yet (stream-through), the host asks again
+            const uint32_t got = ext->read(ext, offset, buffer, n * DISK_SECTOR_SIZE);
+            if (got < n * DISK_SECTOR_SIZE)
+            {
+                return bufsize - num * DISK_SECTOR_SIZE + got;
+            }
+        }
+        else
+        {
+            read_extent_data(ext, offset, buffer, n * DISK_SECTOR_SIZE);
+        }
+        lba += n;
+        buffer += n * DISK_SECTOR_SIZE;
+        num -= n;
     }
     return bufsize;
 }
@@ -113,11 +162,13 @@ uint32_t get_lba_slice(uint32_t lba, void * buffer, uint32_t bufsize)
 
 
 // Write 512 bytes of data to storage at given LBA
+// Only CREDS.JSN is writable
 static const void * set_lba(uint32_t lba, const void * data)
 {
-    if ((lba >= 2152) && (lba <= 2407))
+    const uint32_t idx = find_extent(lba);
+    if ((idx < DISK_EXTENTS_NUM) && (lba >= DISK_EXTENTS[idx].lba) && (DISK_EXTENTS[idx].data == FILE_CREDS_JSN))
     {
-        const uint32_t offset = DISK_SECTOR_SIZE * (lba - 2152);
+        const uint32_t offset = DISK_SECTOR_SIZE * (lba - DISK_EXTENTS[idx].lba);
         memcpy(&FILE_CREDS_JSN[offset], data, DISK_SECTOR_SIZE);
     }
     return data;
@@ -130,13 +181,601 @@ uint32_t set_lba_slice(uint32_t lba, const void * data, uint32_t len)
     while (num > 0)
     {
         set_lba(lba++, data);
+        data += DISK_SECTOR_SIZE;
+        num -= DISK_SECTOR_SIZE;
+    }
+    return len;
+}
+
+
+#if STORAGE_IMG_PACKED
+static uint32_t packed_index(const struct image_buf * buf, uint32_t block)
+{
+    uint32_t end;
+    memcpy(&end, &buf->data[buf->size - sizeof(end) * (block + 1)], sizeof(end));
+    return end;
+}
+
+
+// Pack block (len bytes) behind the blocks packed so far. Returns false if the buffer is full
+static bool pack_block(const unsigned char * block, uint32_t len)
+{
+    struct image_buf * buf = fill_buf;
+    const uint32_t index = sizeof(uint32_t) * (fill_blocks + 1);
+    if (fill_used + index > buf->size)
+    {
+        return false;
+    }
+    const uint32_t room = buf->size - index - fill_used;
+    // Compressed only if that saves something
+    uint32_t packed = lz4_block_compress(block, len, &buf->data[fill_used], (room < len) ? room : len - 1);
+    uint32_t end = fill_used + packed;
+    if (packed == 0)
+    {
+        if (len > room)
+        {
+            return false;
+        }
+        memcpy(&buf->data[fill_used], block, len);
+        packed = len;
+        end = (fill_used + len) | PACKED_RAW;
+    }
+    memcpy(&buf->data[buf->size - index], &end, sizeof(end));
+    fill_used += packed;
+    fill_blocks++;
+    return true;
+}
+
+
+// Bytes of packed block number block of buf, NULL if the index is off (buffer refilled in place meanwhile)
+static const unsigned char * packed_block(const struct image_buf * buf, uint32_t block, uint32_t * packed, bool * raw)
+{
+    const uint32_t start = (block > 0) ? (packed_index(buf, block - 1) & ~PACKED_RAW) : 0;
+    const uint32_t end = packed_index(buf, block);
+    uint32_t len = buf->len - block * STORAGE_IMG_BLOCK;
+    if (len > STORAGE_IMG_BLOCK)
+    {
+        len = STORAGE_IMG_BLOCK;
+    }
+    *raw = (end & PACKED_RAW) != 0;
+    *packed = (end & ~PACKED_RAW) - start;
+    if ((start > (end & ~PACKED_RAW)) || ((end & ~PACKED_RAW) > buf->stored) || (*raw && (*packed != len)))
+    {
+        return NULL;
+    }
+    return &buf->data[start];
+}
+
+
+// Unpack block number block of buf into out. Returns its length, 0 if corrupt
+static uint32_t unpack_block(const struct image_buf * buf, uint32_t block, unsigned char * out)
+{
+    uint32_t len = buf->len - block * STORAGE_IMG_BLOCK;
+    if (len > STORAGE_IMG_BLOCK)
+    {
+        len = STORAGE_IMG_BLOCK;
+    }
+    uint32_t packed;
+    bool raw;
+    const unsigned char * data = packed_block(buf, block, &packed, &raw);
+    if (data == NULL)
+    {
+        return 0;
+    }
+    if (raw)
+    {
+        memcpy(out, data, len);
+        return len;
+    }
+    return (lz4_block_decompress(data, packed, out, len) == len) ? len : 0;
+}
+
+
+// Block number block of buf unpacked: blocks stored as they are in place, the others in the block cache.
+// NULL if corrupt
+static const unsigned char * cached_block(const struct image_buf * buf, uint32_t block)
+{
+    uint32_t packed;
+    bool raw;
+    const unsigned char * data = packed_block(buf, block, &packed, &raw);
+    if ((data == NULL) || raw)
+    {
+        return data;
+    }
+    const uint32_t gen = __atomic_load_n(&buf->gen, __ATOMIC_SEQ_CST);
+    for (uint32_t i = 0; i < STORAGE_IMG_BLOCK_CACHE; i++)
+    {
+        if ((block_cache[i].buf == buf) && (block_cache[i].gen == gen) && (block_cache[i].block == block))
+        {
+            return block_cache[i].data;
+        }
+    }
+    const uint32_t i = block_cache_next++ % STORAGE_IMG_BLOCK_CACHE;
+    if (unpack_block(buf, block, block_cache[i].data) == 0)
+    {
+        block_cache[i].buf = NULL;
+        return NULL;
+    }
+    block_cache[i].buf = buf;
+    block_cache[i].gen = gen;
+    block_cache[i].block = block;
+    return block_cache[i].data;
+}
+#endif
+
+
+// Copy len bytes of the image in buf, from offset on
+static void image_copy(const struct image_buf * buf, uint32_t offset, unsigned char * out, uint32_t len)
+{
+#if STORAGE_IMG_PACKED
+    if (buf->size > 0)
+    {
+        while (len > 0)
+        {
+            const uint32_t at = offset % STORAGE_IMG_BLOCK;
+            uint32_t n = STORAGE_IMG_BLOCK - at;
+            if (n > len)
+            {
+                n = len;
+            }
+            const unsigned char * block = cached_block(buf, offset / STORAGE_IMG_BLOCK);
+            if (block != NULL)
+            {
+                memcpy(out, &block[at], n);
+            }
+            else
+            {
+                memset(out, 0, n);
+            }
+            offset += n;
+            out += n;
+            len -= n;
+        }
+        return;
+    }
+#endif
+    memcpy(out, &buf->data[offset], len);
+}
+
+
+// Read hook of the image extents, serves the front buffer of the slot
+// Lock-free: the buffer is announced in image_reading before use, so it is never handed out for writing meanwhile
+// Of an image still streaming in, only the whole sectors that arrived are served
+static uint32_t read_image(const struct lba_extent * ext, uint32_t offset, void * buffer, uint32_t bufsize)
+{
+    const uint32_t slot = ext - volume_image_extent(0);
+    struct image_buf * buf;
+    do
+    {
+        buf = __atomic_load_n(&image_front[slot], __ATOMIC_SEQ_CST);
+        __atomic_store_n(&image_reading, buf, __ATOMIC_SEQ_CST);
+    } while (buf != __atomic_load_n(&image_front[slot], __ATOMIC_SEQ_CST));
+
+    const uint32_t avail = __atomic_load_n(&buf->avail, __ATOMIC_ACQUIRE);
+    if ((avail < buf->len) && (offset < buf->len))
+    {
+        const uint32_t ready = (offset < avail) ? ((avail - offset) & ~(uint32_t)(DISK_SECTOR_SIZE - 1)) : 0;
+        if (ready < bufsize)
+        {
+            bufsize = ready;
+        }
+    }
+
+    uint32_t rest = (offset < buf->len) ? (buf->len - offset) : 0;
+    if (rest > bufsize)
+    {
+        rest = bufsize;
+    }
+    image_copy(buf, offset, buffer, rest);
+    memset(buffer + rest, 0, bufsize - rest);
+
+    __atomic_store_n(&image_reading, NULL, __ATOMIC_SEQ_CST);
+    return bufsize;
+}
+
+
+static void image_set_state(uint32_t slot, enum image_state state)
+{
+    __atomic_store_n(&image_state[slot], (uint8_t)state, __ATOMIC_SEQ_CST);
+}
+
+
+static bool image_buf_served(const struct image_buf * buf)
+{
+    for (uint32_t i = 0; i < STORAGE_IMG_SLOTS; i++)
+    {
+        if (__atomic_load_n(&image_front[i], __ATOMIC_SEQ_CST) == buf)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+static void fill_start(struct image_buf * buf)
+{
+    fill_buf = buf;
+    fill_len = 0;
+#if STORAGE_IMG_PACKED
+    fill_used = 0;
+    fill_blocks = 0;
+#endif
+}
+
+
+void storage_image_fetching(uint32_t slot)
+{
+    image_state_before[slot] = __atomic_load_n(&image_state[slot], __ATOMIC_SEQ_CST);
+    image_set_state(slot, IMAGE_DOWNLOADING);
+}
+
+
+struct image_buf * storage_image_acquire(uint32_t slot, uint32_t size_hint)
+{
+    storage_image_fetching(slot);
+
+    struct image_buf * best = NULL;
+    for (uint32_t i = 0; i < NUM_IMAGE_BUFS; i++)
+    {
+        struct image_buf * buf = &image_bufs[i];
+        if (!image_buf_served(buf) && ((best == NULL) || (buf->size > best->size)))
+        {
+            best = buf;
+        }
+    }
+    // No spare buffer, or the image won't fit it: refill the slot in place.
+    // A slot serving mapped flash has left its RAM buffer to the spares
+    struct image_buf * front = storage_image_front(slot);
+    if ((best == NULL) || ((best->size < size_hint) && (front->size > 0)))
+    {
+        // The old image goes first: the host reads an empty file until the new one is published,
+        // never half of each
+        __atomic_store_n(&front->len, 0, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&front->avail, 0, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&front->gen, 1, __ATOMIC_SEQ_CST);
+        volume_set_image_size(slot, 0);
+        if (publish_hook != NULL)
+        {
+            publish_hook(slot);
+        }
+        while (__atomic_load_n(&image_reading, __ATOMIC_SEQ_CST) == front)
+        {
+        }
+        fill_start(front);
+        return front;
+    }
+    // A read that started before the last publish may still be copying from it
+    while (__atomic_load_n(&image_reading, __ATOMIC_SEQ_CST) == best)
+    {
+    }
+    fill_start(best);
+    return best;
+}
+
+
+int storage_image_append(struct image_buf * buf, const void * data, uint32_t len)
+{
+    if (buf != fill_buf)
+    {
+        return -1;
+    }
+#if STORAGE_IMG_PACKED
+    const unsigned char * src = data;
+    while (len > 0)
+    {
+        const uint32_t at = fill_len % STORAGE_IMG_BLOCK;
+        if ((at == 0) && (len >= STORAGE_IMG_BLOCK))
+        {
+            // Whole block, packed straight from data
+            if (!pack_block(src, STORAGE_IMG_BLOCK))
+            {
+                return -1;
+            }
+            fill_len += STORAGE_IMG_BLOCK;
+            src += STORAGE_IMG_BLOCK;
+            len -= STORAGE_IMG_BLOCK;
+            continue;
+        }
+        uint32_t n = STORAGE_IMG_BLOCK - at;
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(&fill_block[at], src, n);
+        fill_len += n;
+        src += n;
+        len -= n;
+        if ((at + n == STORAGE_IMG_BLOCK) && !pack_block(fill_block, STORAGE_IMG_BLOCK))
+        {
+            return -1;
+        }
+    }
+    // Room for the block begun as it is, so publish can't run out of it
+    const uint32_t rest = fill_len % STORAGE_IMG_BLOCK;
+    if ((rest > 0) && (fill_used + rest + sizeof(uint32_t) * (fill_blocks + 1) > buf->size))
+    {
+        return -1;
+    }
+#else
+    if (len > buf->size - fill_len)
+    {
+        return -1;
+    }
+    memcpy(&buf->data[fill_len], data, len);
+    fill_len += len;
+#endif
+    return 0;
+}
+
+
+// Swap buf in as the front of slot
+static void publish(uint32_t slot, struct image_buf * buf)
+{
+    struct image_buf * old = __atomic_exchange_n(&image_front[slot], buf, __ATOMIC_SEQ_CST);
+    volume_set_image_size(slot, buf->len);
+    image_set_state(slot, (buf->len > 0) ? IMAGE_READY : IMAGE_EMPTY);
+    if (publish_hook != NULL)
+    {
+        publish_hook(slot);
+    }
+
+    // A read that started before the swap may still be copying from the old buffer
+    while ((old != buf) && (__atomic_load_n(&image_reading, __ATOMIC_SEQ_CST) == old))
+    {
+    }
+}
+
+
+void storage_image_publish(uint32_t slot, struct image_buf * buf, uint32_t len)
+{
+#if STORAGE_IMG_PACKED
+    if (len > fill_len)
+    {
+        len = fill_len;
+    }
+    if (buf != fill_buf)
+    {
+        len = 0;
+    }
+    else if (fill_blocks * STORAGE_IMG_BLOCK < fill_len)
+    {
+        pack_block(fill_block, fill_len % STORAGE_IMG_BLOCK);
+    }
+    fill_buf = NULL;
+    buf->stored = fill_used;
+#else
+    if (len > buf->size)
+    {
+        len = buf->size;
+    }
+    buf->stored = len;
+#endif
+    buf->len = len;
+    buf->avail = len;
+    __atomic_add_fetch(&buf->gen, 1, __ATOMIC_SEQ_CST);
+    publish(slot, buf);
+}
+
+
+bool storage_image_fallback(uint32_t slot, uint32_t image)
+{
+    const uint32_t len = fallback_size(image);
+    struct image_buf * buf = storage_image_acquire(slot, len);
+    // Unpacked block by block right where append would copy it to
+    for (uint32_t block = 0; block * STORAGE_IMG_BLOCK < len; block++)
+    {
+        const uint32_t rest = len - fill_len;
+        const uint32_t n = (rest < STORAGE_IMG_BLOCK) ? rest : STORAGE_IMG_BLOCK;
+#if STORAGE_IMG_PACKED
+        bool ok = (fallback_read_block(image, block, fill_block) == n);
+        if (ok && (n == STORAGE_IMG_BLOCK))
+        {
+            ok = pack_block(fill_block, n);
+        }
+        else if (ok)
+        {
+            // Last block, publish packs it: make sure it fits as it is
+            ok = (fill_used + n + sizeof(uint32_t) * (fill_blocks + 1) <= buf->size);
+        }
+#else
+        const bool ok = (n <= buf->size - fill_len) && (fallback_read_block(image, block, &buf->data[fill_len]) == n);
+#endif
+        if (!ok)
+        {
+            storage_image_abort(slot, buf);
+            return false;
+        }
+        fill_len += n;
     }
+    if (len == 0)
+    {
+        storage_image_abort(slot, buf);
+        return false;
+    }
+    storage_image_publish(slot, buf, len);
+    return true;
+}
+
+
+uint32_t storage_image_read_block(const struct image_buf * buf, uint32_t block, void * out)
+{
+    const uint32_t offset = block * STORAGE_IMG_BLOCK;
+    if (offset >= buf->len)
+    {
+        return 0;
+    }
+#if STORAGE_IMG_PACKED
+    if (buf->size > 0)
+    {
+        return unpack_block(buf, block, out);
+    }
+#endif
+    const uint32_t len = (buf->len - offset < STORAGE_IMG_BLOCK) ? (buf->len - offset) : STORAGE_IMG_BLOCK;
+    memcpy(out, &buf->data[offset], len);
     return len;
 }
 
 
+static void publish_mapped(uint32_t slot, const void * data, uint32_t len, uint32_t avail)
+{
+    // Whichever of the two is not the front, nobody reads it since the last publish returned
+    struct image_buf * buf = &image_mapped[slot][0];
+    if (buf == storage_image_front(slot))
+    {
+        buf = &image_mapped[slot][1];
+    }
+    buf->data = (unsigned char *)data;
+    buf->size = 0;
+    buf->len = len;
+    buf->avail = avail;
+    buf->stored = len;
+    __atomic_add_fetch(&buf->gen, 1, __ATOMIC_SEQ_CST);
+    publish(slot, buf);
+}
+
+
+void storage_image_publish_mapped(uint32_t slot, const void * data, uint32_t len)
+{
+    publish_mapped(slot, data, len, len);
+}
+
+
+void storage_image_stream(uint32_t slot, const void * data, uint32_t len)
+{
+    publish_mapped(slot, data, len, 0);
+}
+
+
+void storage_image_stream_progress(uint32_t slot, uint32_t avail)
+{
+    struct image_buf * buf = storage_image_front(slot);
+    if ((buf->size == 0) && (avail <= buf->len))
+    {
+        __atomic_store_n(&buf->avail, avail, __ATOMIC_RELEASE);
+    }
+}
+
+
+void storage_image_abort(uint32_t slot, struct image_buf * buf)
+{
+    if ((buf != NULL) && (buf == storage_image_front(slot)))
+    {
+        // Refilled in place, the previous image is gone
+        buf->len = 0;
+        buf->avail = 0;
+        volume_set_image_size(slot, 0);
+        image_set_state(slot, IMAGE_EMPTY);
+        if (publish_hook != NULL)
+        {
+            publish_hook(slot);
+        }
+        return;
+    }
+    image_set_state(slot, (enum image_state)image_state_before[slot]);
+}
+
+
+struct image_buf * storage_image_front(uint32_t slot)
+{
+    return __atomic_load_n(&image_front[slot], __ATOMIC_SEQ_CST);
+}
+
+
+void storage_image_on_publish(void (* hook)(uint32_t slot))
+{
+    publish_hook = hook;
+}
+
+
+void storage_ring_opened(uint32_t slot)
+{
+    if ((slot >= STORAGE_IMG_SLOTS) || ((int32_t)slot == __atomic_load_n(&ring_cursor, __ATOMIC_SEQ_CST)))
+    {
+        return;     // the host reads the current image again
+    }
+    if (__atomic_exchange_n(&image_state[slot], IMAGE_SERVED, __ATOMIC_SEQ_CST) == IMAGE_READY)
+    {
+        __atomic_add_fetch(&ring_hits, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        __atomic_add_fetch(&ring_misses, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&ring_cursor, (int32_t)slot, __ATOMIC_SEQ_CST);
+}
+
+
+int32_t storage_ring_next(void)
+{
+    const int32_t cursor = __atomic_load_n(&ring_cursor, __ATOMIC_SEQ_CST);
+    for (int32_t i = 1; i <= STORAGE_IMG_PREFETCH; i++)
+    {
+        const int32_t slot = (cursor + i) % STORAGE_IMG_SLOTS;
+        if (storage_ring_state(slot) != IMAGE_READY)
+        {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+
+void storage_ring_keep(uint32_t slot)
+{
+    if ((slot < STORAGE_IMG_SLOTS) && (storage_image_front(slot)->len > 0))
+    {
+        image_set_state(slot, IMAGE_READY);
+    }
+}
+
+
+enum image_state storage_ring_state(uint32_t slot)
+{
+    return (enum image_state)__atomic_load_n(&image_state[slot], __ATOMIC_SEQ_CST);
+}
+
+
+void storage_ring_stats(struct image_ring_stats * stats)
+{
+    stats->hits = __atomic_load_n(&ring_hits, __ATOMIC_RELAXED);
+    stats->misses = __atomic_load_n(&ring_misses, __ATOMIC_RELAXED);
+    stats->cursor = __atomic_load_n(&ring_cursor, __ATOMIC_SEQ_CST);
+}
+
+
+uint32_t storage_image_mem(void)
+{
+#if STORAGE_IMG_PACKED
+    return sizeof(image_mem) + STORAGE_IMG_BACK_SIZE + sizeof(fill_block) + sizeof(block_cache);
+#else
+    return sizeof(image_mem) + STORAGE_IMG_BACK_SIZE;
+#endif
+}
+
+
 void prepare_files(void)
 {
-    memcpy(FILE_IMG_JPG, FILE_IMG1_JPG, FILE_IMG1_JPG_len);
-    FILE_IMG_JPG_len = FILE_IMG1_JPG_len;
-}
\ No newline at end of file
+    for (uint32_t i = 0; i < STORAGE_IMG_SLOTS; i++)
+    {
+        image_bufs[i].data = image_mem[i];
+        image_bufs[i].size = STORAGE_IMG_SIZE;
+        image_front[i] = &image_bufs[i];
+
+        struct lba_extent * ext = volume_image_extent(i);
+        ext->data = NULL;
+        ext->len = 0;
+        ext->read = read_image;
+    }
+#if STORAGE_IMG_BACK_SIZE > 0
+    image_bufs[STORAGE_IMG_SLOTS].data = image_mem_spare;
+    image_bufs[STORAGE_IMG_SLOTS].size = STORAGE_IMG_BACK_SIZE;
+#endif
+
+    // Fallback images until the first fetch, the first ones of the bundle
+    const uint32_t fallbacks = fallback_count();
+    for (uint32_t i = 0; (i < STORAGE_IMG_SLOTS) && (fallbacks > 0); i++)
+    {
+        storage_image_fallback(i, i % fallbacks);
+    }
+}
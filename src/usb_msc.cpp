@@ -1,55 +1,169 @@
 #include "usb_msc.h"
 #include <Arduino.h>
-#include <FastLED.h>
 #include "USB.h"
 #include "USBMSC.h"
+#include "storage.h"
+#include "volume.h"
+#include "lba_trace.h"
+#include "led_status.h"
 
 USBMSC MSC;
-extern CRGB leds[1];
 
-extern "C" uint32_t get_lba_slice(uint32_t lba, void *buffer, uint32_t bufsize);
-extern "C" uint32_t set_lba_slice(uint32_t lba, const void *data, uint32_t len);
+struct event_queue usb_events;
+// USB task only
+static int opened_slot = -1;                        // slot the host opened last
+static uint32_t slot_reads[STORAGE_IMG_SLOTS];     // reads since the host opened the slot
 
-extern volatile int http_fetch_trigger;
+// Media change: hosts cache the FAT, the directory and file data and don't notice a new image on their own.
+// Taking the medium away for a moment (MSC.mediaPresent) makes them see NOT READY / MEDIUM NOT PRESENT on
+// their next TEST UNIT READY and drop what they cached once it is back. Frames differ in how often they poll,
+// so the pulse is set per frame profile: hold_ms must span at least one poll, quiet_ms keeps it clear of reads
+struct frame_profile
+{
+    const char *name;
+    uint16_t hold_ms;       // medium away this long, 0: never signal a change
+    uint16_t quiet_ms;      // only after this long without a publish and without host reads
+};
+
+static const frame_profile PROFILES[] =
+{
+    { "none",  0,    0    },    // host finds new images by itself (or not)
+    { "eject", 2500, 1000 },    // PC style hosts, polling every 1 to 2 s
+    { "fast",  300,  250  },    // frames polling TEST UNIT READY continuously
+};
+
+#ifndef USB_MSC_PROFILE
+#define USB_MSC_PROFILE "none"
+#endif
+
+static const frame_profile *profile = &PROFILES[0];
+
+// Written by the fetch task (publishes) and the USB read path, millis() timestamps, 0: none
+static uint32_t changed_at[STORAGE_IMG_SLOTS];  // slot published, host hasn't opened it since
+static uint32_t last_change;
+static uint32_t last_read;
+static bool host_reading;           // host has read anything: images before that are the ones it mounts with
+static bool change_pending;
+static uint32_t eject_until;        // medium away until then, 0: present
+
+// Time-to-new-image: publish until the host reads the first sector of that image
+static uint32_t tti_count, tti_sum, tti_max, tti_last;
+static uint32_t media_changes;
+
+// Time spent in onRead, all reads and the ones opening CREDS.JSN or an image (USB task only)
+static uint32_t read_count, read_us_sum, read_us_max;
+static uint32_t open_count, open_us_sum, open_us_max;
+
+
+static void post(enum storage_event_type type, uint32_t slot, uint32_t arg)
+{
+    const struct storage_event ev = { millis(), (uint16_t)type, (uint16_t)slot, arg };
+    event_queue_push(&usb_events, &ev);
+}
+
+// Host read up to and including the last sector of the image in slot
+static bool image_finished(int slot, uint32_t lba, uint32_t got)
+{
+    const uint32_t len = storage_image_front(slot)->len;
+    const uint32_t last = volume::file_lba(volume::FIRST_IMAGE + slot) + (len - 1) / DISK_SECTOR_SIZE;
+    return (len > 0) && (lba <= last) && (lba + got / DISK_SECTOR_SIZE > last);
+}
 
 
 // offset ist immer 0 !?
 // bufsize ist minimal 512, maxixmal 4096 und immer ein vielfaches von 512 !?
+// (lba_trace.h records both for every call, "get trace" shows them)
 static int32_t onRead(uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize)
 {
-    if (lba == 2152) // CREDS.JSN
+    const uint32_t t_us = micros();
+    const int slot = volume::image_at(lba);
+    const bool creds = (lba == volume::file_lba(volume::CREDS));
+    if (creds)
     {
-        leds[0] = CRGB::Yellow;
-        FastLED.show();
+        led_status_set(LED_CREDS);
     }
-    else if (lba == 2156) // IMG1.JPG
+    else if (slot >= 0) //on access to first lba of an image
     {
-        http_fetch_trigger = millis(); //on access to first lba of IMG1
-        leds[0] = CRGB::Green;
-        FastLED.show();
+        const uint32_t published = __atomic_exchange_n(&changed_at[slot], 0, __ATOMIC_SEQ_CST);
+        if (published != 0)
+        {
+            tti_last = millis() - published;
+            tti_sum += tti_last;
+            tti_max = (tti_last > tti_max) ? tti_last : tti_max;
+            tti_count++;
+        }
+        storage_ring_opened(slot);
+        if (slot != opened_slot)    // not the same image again, or a retry of a streamed one
+        {
+            opened_slot = slot;
+            slot_reads[slot] = 0;
+            post(STORAGE_EV_SLOT_OPENED, slot, 0);  // tops up the ring behind it
+        }
+        led_status_set((slot % 2) ? LED_SLOT_ODD : LED_SLOT_EVEN);
     }
-    else if (lba == 2412) // IMG2.JPG
+    else if (lba == volume::LAYOUT.root_lba)
     {
-        http_fetch_trigger = millis(); //on access to first lba of IMG2
-        leds[0] = CRGB::Blue;
-        FastLED.show();
+        post(STORAGE_EV_DIR_READ, 0, 0);
     }
 
-    get_lba_slice(lba, buffer, bufsize);
-    return bufsize;
+    __atomic_store_n(&last_read, millis() | 1, __ATOMIC_SEQ_CST);
+    host_reading = true;
+    const uint32_t got = get_lba_slice(lba, buffer, bufsize);
+    lba_trace_record(t_us, LBA_TRACE_READ, lba, offset, bufsize, got);
+    const int holding = volume::image_holding(lba);
+    if ((holding >= 0) && (got > 0))
+    {
+        slot_reads[holding]++;
+        if (image_finished(holding, lba, got))
+        {
+            post(STORAGE_EV_SLOT_FINISHED, holding, slot_reads[holding]);
+        }
+    }
+
+    const uint32_t dt = micros() - t_us;
+    read_count++;
+    read_us_sum += dt;
+    read_us_max = max(read_us_max, dt);
+    if (creds || (slot >= 0))
+    {
+        open_count++;
+        open_us_sum += dt;
+        open_us_max = max(open_us_max, dt);
+    }
+    if (got == 0)
+    {
+        // Stream-through: sector not downloaded yet. TinyUSB calls again for 0 bytes right away, from a task
+        // at the top priority: one tick off the CPU per attempt keeps it from starving its core
+        vTaskDelay(1);
+    }
+    return got;
 }
 
 static int32_t onWrite(uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize)
 {
     // set_lba_slice(lba, buffer, bufsize);
+    lba_trace_record(micros(), LBA_TRACE_WRITE, lba, offset, bufsize, bufsize);
     return bufsize;
 }
 
+// Publish hook (storage.h), runs in the fetch loop
+static void onPublish(uint32_t slot)
+{
+    if (!host_reading)
+    {
+        return;
+    }
+    const uint32_t now = millis() | 1;
+    __atomic_store_n(&changed_at[slot], now, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&last_change, now, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&change_pending, true, __ATOMIC_SEQ_CST);
+}
+
 static bool onStartStop(uint8_t power_condition, bool start, bool load_eject)
 {
     Serial.printf("MSC START/STOP: power: %u, start: %u, eject: %u\n", power_condition, start, load_eject);
-    leds[0] = CRGB::Red;
-    FastLED.show();
+    post(STORAGE_EV_START_STOP, 0, (power_condition << 2) | (start << 1) | load_eject);
+    led_status_set(LED_IDLE);
     return true;
 }
 
@@ -69,10 +183,71 @@ static void usbEventCallback(void *arg, esp_event_base_t event_base, int32_t eve
     }
 }
 
-extern "C" void prepare_files(void);
+bool usb_msc_set_profile(const char *name)
+{
+    for (const frame_profile &p : PROFILES)
+    {
+        if (strcmp(p.name, name) == 0)
+        {
+            profile = &p;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *usb_msc_profile_name(uint32_t i)
+{
+    return (i < sizeof(PROFILES) / sizeof(PROFILES[0])) ? PROFILES[i].name : NULL;
+}
+
+void usb_msc_status(char *buf, size_t len)
+{
+    snprintf(buf, len, "profile %s (away %u ms, quiet %u ms), %u media changes, time to new image: %u opened, last %u ms, avg %u ms, max %u ms, %u events dropped; "
+             "onRead: %u reads, avg %u us, max %u us, %u opens, avg %u us, max %u us",
+             profile->name, profile->hold_ms, profile->quiet_ms, media_changes,
+             tti_count, tti_last, tti_count ? (tti_sum / tti_count) : 0, tti_max, event_queue_dropped(&usb_events),
+             read_count, read_count ? (read_us_sum / read_count) : 0, read_us_max,
+             open_count, open_count ? (open_us_sum / open_count) : 0, open_us_max);
+}
+
+void usb_msc_process(void)
+{
+    const uint32_t now = millis();
+    if (eject_until != 0)
+    {
+        if ((int32_t)(now - eject_until) >= 0)
+        {
+            eject_until = 0;
+            MSC.mediaPresent(true);
+            led_status_set(LED_IDLE);
+        }
+        return;
+    }
+
+    // Nothing new, or nobody looked since the last change: they'll read the new images anyway
+    const uint32_t read_at = __atomic_load_n(&last_read, __ATOMIC_SEQ_CST);
+    if ((profile->hold_ms == 0) || !__atomic_load_n(&change_pending, __ATOMIC_SEQ_CST) || (read_at == 0))
+    {
+        return;
+    }
+    if (((now - __atomic_load_n(&last_change, __ATOMIC_SEQ_CST)) < profile->quiet_ms) || ((now - read_at) < profile->quiet_ms))
+    {
+        return;     // more images to come, or the host is in the middle of reading one
+    }
+    __atomic_store_n(&change_pending, false, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&last_read, 0, __ATOMIC_SEQ_CST);
+    media_changes++;
+    eject_until = (now + profile->hold_ms) | 1;
+    MSC.mediaPresent(false);
+    led_status_set(LED_MEDIA_AWAY);
+}
+
 void usb_msc_begin(void)
 {
+    usb_msc_set_profile(USB_MSC_PROFILE);
     prepare_files();
+    storage_image_on_publish(onPublish);
     USB.onEvent(usbEventCallback);
 
     MSC.vendorID("ESP32");       // max 8 chars
@@ -83,5 +258,5 @@ void usb_msc_begin(void)
     MSC.onWrite(onWrite);
     MSC.mediaPresent(true);
     MSC.isWritable(false);
-    MSC.begin(64*1024, 512);     // Identify as 32MB Stick
+    MSC.begin(volume::DISK_SECTORS, DISK_SECTOR_SIZE);     // Identify as 32MB Stick
 }
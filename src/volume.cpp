@@ -0,0 +1,224 @@
+// Filesystem structures and LBA map of the virtual FAT16 volume, generated at compile time from volume.h
+#include "volume.h"
+#include "storage.h"
+
+extern "C" {
+    extern unsigned char FILE_CREDS_JSN[volume::FILES[volume::CREDS].size];   // defined in storage.c
+}
+
+using volume::LAYOUT;
+
+// Same layout as the stick formatted with mkfs.fat (see layout.txt and development.md)
+static_assert(LAYOUT.p.partition_lba == 2048 && LAYOUT.p.partition_sectors == 32768, "MBR differs from layout.txt");
+static_assert(LAYOUT.sectors_per_fat == 32, "VBR differs from layout.txt");
+static_assert(LAYOUT.fat_lba[0] == 2052 && LAYOUT.fat_lba[1] == 2084, "FAT position differs from layout.txt");
+static_assert(LAYOUT.root_lba == 2116 && LAYOUT.root_sectors == 32, "root directory differs from layout.txt");
+static_assert(LAYOUT.map[volume::CREDS].lba == 2152 && LAYOUT.map[volume::CREDS].cluster == 3
+           && LAYOUT.map[volume::CREDS].clusters == 1, "CREDS.JSN differs from layout.txt");
+#if (STORAGE_IMG_SLOTS == 2) && (STORAGE_IMG_FILE_SIZE == 128 * 1024)
+static_assert(LAYOUT.map[volume::FIRST_IMAGE].lba == 2156 && LAYOUT.map[volume::FIRST_IMAGE].cluster == 4
+           && LAYOUT.map[volume::FIRST_IMAGE].clusters == 64, "IMG1.JPG differs from layout.txt");
+static_assert(LAYOUT.map[volume::FIRST_IMAGE + 1].lba == 2412 && LAYOUT.map[volume::FIRST_IMAGE + 1].cluster == 68
+           && LAYOUT.map[volume::FIRST_IMAGE + 1].clusters == 64, "IMG2.JPG differs from layout.txt");
+#endif
+
+static_assert(STORAGE_IMG_BACK_SIZE <= STORAGE_IMG_SIZE, "spare buffer bigger than slot buffer");
+static_assert(STORAGE_IMG_SIZE <= STORAGE_IMG_FILE_SIZE, "image buffer exceeds the image file");
+
+static constexpr uint32_t FAT_SECTORS = LAYOUT.fat_used_sectors;
+static constexpr uint32_t ROOTDIR_SECTORS = fat16::div_up(volume::NUM_FILES * 32, DISK_SECTOR_SIZE);
+
+static constexpr auto MBR     = fat16::make_mbr(LAYOUT);
+static constexpr auto VBR     = fat16::make_vbr(LAYOUT);
+static constexpr auto FAT_INIT     = fat16::make_fat<FAT_SECTORS>(LAYOUT);
+static constexpr auto ROOTDIR_INIT = fat16::make_rootdir<ROOTDIR_SECTORS>(LAYOUT);
+
+#if (STORAGE_IMG_SLOTS == 2) && (STORAGE_IMG_FILE_SIZE == 128 * 1024)
+// The sectors of the old xxd dumps (src/mbr.c, vbr.c, fat.c, rootdir.c), byte for byte, but for what is left
+// out on purpose: MBR boot code and CHS fields, VBR boot code, directory timestamps and the CREDS.JSN size,
+// which was 2032 bytes and is now the 2048 of its cluster (layout.txt)
+template <size_t N, size_t M>
+static constexpr bool same_bytes(const std::array<uint8_t, N> & a, size_t at, const uint8_t (&b)[M])
+{
+    for (size_t i = 0; i < M; i++)
+    {
+        if (a[at + i] != b[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+static constexpr bool zero_from(const std::array<uint8_t, N> & a, size_t at, size_t end)
+{
+    for (size_t i = at; i < end; i++)
+    {
+        if (a[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Directory entry i as in rootdir.c, except the timestamps (bytes 13, 14 and 22) and, if !size, the size
+static constexpr bool same_entry(int i, const uint8_t (&old)[32], bool size)
+{
+    for (size_t b = 0; b < (size ? 32u : 28u); b++)
+    {
+        if ((b != 13) && (b != 14) && (b != 22) && (ROOTDIR_INIT[32 * i + b] != old[b]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Chains 3 (CREDS.JSN), 4-67 (IMG1.JPG) and 68-131 (IMG2.JPG) as in fat.c, the rest of the sector free
+static constexpr bool same_fat()
+{
+    constexpr uint8_t HEAD[] = { 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF };
+    if (!same_bytes(FAT_INIT, 0, HEAD) || !zero_from(FAT_INIT, 2 * 132, DISK_SECTOR_SIZE))
+    {
+        return false;
+    }
+    for (uint32_t c = 4; c < 132; c++)
+    {
+        const uint32_t next = ((c == 67) || (c == 131)) ? 0xFFFF : c + 1;
+        if ((uint32_t)(FAT_INIT[2 * c] | (FAT_INIT[2 * c + 1] << 8)) != next)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static constexpr uint8_t OLD_PARTITION_STATUS[] = { 0x00 };
+static constexpr uint8_t OLD_PARTITION_TYPE_LBA[] = { 0x06 };
+static constexpr uint8_t OLD_PARTITION_EXTENT[] = { 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00 };
+static constexpr uint8_t OLD_BPB[62] =
+{
+    0xeb, 0x3c, 0x90, 0x6d, 0x6b, 0x66, 0x73, 0x2e, 0x66, 0x61, 0x74, 0x00, 0x02, 0x04, 0x04, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x80, 0xf8, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x29, 0x2e, 0x73, 0x1e, 0xf8, 0x4e, 0x4f, 0x20, 0x4e, 0x41,
+    0x4d, 0x45, 0x20, 0x20, 0x20, 0x20, 0x46, 0x41, 0x54, 0x31, 0x36, 0x20, 0x20, 0x20,
+};
+static constexpr uint8_t SIGNATURE[] = { 0x55, 0xAA };
+static constexpr uint8_t OLD_CREDS_ENTRY[32] =
+{
+    0x43, 0x52, 0x45, 0x44, 0x53, 0x20, 0x20, 0x20, 0x4a, 0x53, 0x4e, 0x20, 0x00, 0x05, 0x7a, 0x90,
+    0x53, 0x5c, 0x53, 0x5c, 0x00, 0x00, 0x7a, 0x90, 0x53, 0x5c, 0x03, 0x00, 0xf0, 0x07, 0x00, 0x00,
+};
+static constexpr uint8_t OLD_IMG1_ENTRY[32] =
+{
+    0x49, 0x4d, 0x47, 0x31, 0x20, 0x20, 0x20, 0x20, 0x4a, 0x50, 0x47, 0x20, 0x00, 0x23, 0x82, 0x90,
+    0x53, 0x5c, 0x53, 0x5c, 0x00, 0x00, 0x82, 0x90, 0x53, 0x5c, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00,
+};
+static constexpr uint8_t OLD_IMG2_ENTRY[32] =
+{
+    0x49, 0x4d, 0x47, 0x32, 0x20, 0x20, 0x20, 0x20, 0x4a, 0x50, 0x47, 0x20, 0x00, 0x04, 0x87, 0x90,
+    0x53, 0x5c, 0x53, 0x5c, 0x00, 0x00, 0x87, 0x90, 0x53, 0x5c, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00,
+};
+static constexpr uint8_t CREDS_SIZE[] = { 0x00, 0x08, 0x00, 0x00 };
+
+static_assert(same_bytes(MBR, 446, OLD_PARTITION_STATUS) && same_bytes(MBR, 450, OLD_PARTITION_TYPE_LBA)
+           && same_bytes(MBR, 454, OLD_PARTITION_EXTENT) && zero_from(MBR, 462, 510) && same_bytes(MBR, 510, SIGNATURE),
+              "partition table differs from mbr.c");
+static_assert(same_bytes(VBR, 0, OLD_BPB) && same_bytes(VBR, 510, SIGNATURE), "BPB differs from vbr.c");
+static_assert(same_fat(), "cluster chains differ from fat.c");
+static_assert(same_entry(0, OLD_CREDS_ENTRY, false) && same_bytes(ROOTDIR_INIT, 28, CREDS_SIZE)
+           && same_entry(1, OLD_IMG1_ENTRY, true) && same_entry(2, OLD_IMG2_ENTRY, true)
+           && zero_from(ROOTDIR_INIT, 96, DISK_SECTOR_SIZE), "root directory differs from rootdir.c");
+#endif
+
+// FAT and root directory live in RAM, image entries follow the published size
+alignas(4) static std::array<uint8_t, FAT_SECTORS * DISK_SECTOR_SIZE> FAT = FAT_INIT;
+alignas(4) static std::array<uint8_t, ROOTDIR_SECTORS * DISK_SECTOR_SIZE> ROOTDIR = ROOTDIR_INIT;
+
+enum { EXT_MBR, EXT_VBR, EXT_FAT1, EXT_FAT2, EXT_ROOTDIR, EXT_FILES };
+
+
+static constexpr size_t NUM_EXTENTS = EXT_FILES + volume::NUM_FILES;
+
+// Sorted by LBA, one extent per structure and file
+static constexpr std::array<lba_extent, NUM_EXTENTS> make_extents()
+{
+    std::array<lba_extent, NUM_EXTENTS> e{};
+    e[EXT_MBR]     = { 0,                      1,               MBR.data(),     (uint32_t)MBR.size(),     nullptr };
+    e[EXT_VBR]     = { LAYOUT.p.partition_lba, 1,               VBR.data(),     (uint32_t)VBR.size(),     nullptr };
+    e[EXT_FAT1]    = { LAYOUT.fat_lba[0],      FAT_SECTORS,     FAT.data(),     (uint32_t)FAT.size(),     nullptr };
+    e[EXT_FAT2]    = { LAYOUT.fat_lba[1],      FAT_SECTORS,     FAT.data(),     (uint32_t)FAT.size(),     nullptr };
+    e[EXT_ROOTDIR] = { LAYOUT.root_lba,        ROOTDIR_SECTORS, ROOTDIR.data(), (uint32_t)ROOTDIR.size(), nullptr };
+    e[EXT_FILES + volume::CREDS] = { volume::file_lba(volume::CREDS), volume::file_sectors(volume::CREDS),
+                                     FILE_CREDS_JSN, sizeof(FILE_CREDS_JSN), nullptr };
+    for (int i = volume::FIRST_IMAGE; i < volume::NUM_FILES; i++)
+    {
+        e[EXT_FILES + i] = { volume::file_lba(i), volume::file_sectors(i), nullptr, 0, nullptr };   // storage.c hooks in
+    }
+    return e;
+}
+
+static std::array<lba_extent, NUM_EXTENTS> EXTENTS = make_extents();
+
+struct lba_extent * const DISK_EXTENTS = EXTENTS.data();
+const uint32_t DISK_EXTENTS_NUM = NUM_EXTENTS;
+
+const uint32_t VOLUME_IMAGES = volume::NUM_IMAGES;
+
+
+struct lba_extent * volume_image_extent(uint32_t image)
+{
+    return &DISK_EXTENTS[EXT_FILES + volume::FIRST_IMAGE + image];
+}
+
+
+const char * volume_lba_name(uint32_t lba, uint32_t * sector)
+{
+    static const char * const NAMES[EXT_FILES] = { "MBR", "VBR", "FAT1", "FAT2", "ROOTDIR" };
+    for (size_t i = 0; i < NUM_EXTENTS; i++)
+    {
+        if ((lba >= EXTENTS[i].lba) && (lba < EXTENTS[i].lba + EXTENTS[i].count))
+        {
+            *sector = lba - EXTENTS[i].lba;
+            return (i < EXT_FILES) ? NAMES[i] : volume::FILES[i - EXT_FILES].name;
+        }
+    }
+    *sector = 0;
+    return NULL;
+}
+
+
+void volume_set_image_size(uint32_t image, uint32_t len)
+{
+    if (image >= (uint32_t)volume::NUM_IMAGES)
+    {
+        return;
+    }
+    const uint32_t i = volume::FIRST_IMAGE + image;
+    const fat16::file_map & map = LAYOUT.map[i];
+    const uint32_t cluster_size = LAYOUT.p.sectors_per_cluster * DISK_SECTOR_SIZE;
+    if (len > LAYOUT.files[i].size)
+    {
+        len = LAYOUT.files[i].size;
+    }
+    const uint32_t used = fat16::div_up(len, cluster_size);
+    uint8_t * entry = &ROOTDIR[32 * i];
+
+    // Shrink the directory entry before the chain, grow the chain before the entry,
+    // so the host never sees a size that runs past the end of the chain
+    const uint32_t old_len = entry[28] | (entry[29] << 8) | (entry[30] << 16) | ((uint32_t)entry[31] << 24);
+    const bool grow = (len > old_len);
+    if (!grow)
+    {
+        fat16::put32(&entry[28], len);
+        fat16::put16(&entry[26], (len > 0) ? map.cluster : 0);
+    }
+    fat16::put_chain(FAT.data(), FAT.size(), map.cluster, used, map.clusters);
+    if (grow)
+    {
+        fat16::put16(&entry[26], map.cluster);
+        fat16::put32(&entry[28], len);
+    }
+}
@@ -0,0 +1,206 @@
+/* bench_fetch.c - Host benchmark of the HTTP body receive path against webserver/server.py
+ *
+ * Downloads images over one keep-alive connection like the fetch task does, reading the body two ways:
+ *   poll:   read what the socket holds, else sleep 1 ms (the delay(1) loop http_client.cpp had)
+ *   select: sleep in select() until data arrives, fill 4 KB chunks (http_read() in http_client.cpp)
+ * The receive buffer is cut down to the ESP32's TCP window, so a reader that sleeps stalls the sender
+ * the way it does on the device. Start the server first, with --rate for WiFi-like speed
+ * ("make fetch-bench" does both).
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#define CHUNK       4096        // IMAGE_CACHE_SECTOR, what the firmware hands to the slot or flash at once
+#define TCP_WND     5760        // lwIP receive window of the Arduino ESP32 core
+#define STALL_MS    5000
+
+struct stats {
+    uint32_t fetches;
+    uint64_t bytes;
+    double wall_s;
+    double cpu_s;
+    uint32_t reads;
+    uint32_t sleeps;            // 1 ms sleeps (poll), select() calls (select)
+};
+
+static double clock_s(clockid_t id) {
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int connect_to(const char *host, const char *port) {
+    struct addrinfo hints = {0}, *ai;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, port, &hints, &ai) != 0) {
+        return -1;
+    }
+    const int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0) {
+        freeaddrinfo(ai);
+        return -1;
+    }
+    const int rcvbuf = TCP_WND / 2;     // Linux doubles it for bookkeeping
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (connect(fd, ai->ai_addr, ai->ai_addrlen) != 0) {
+        close(fd);
+        freeaddrinfo(ai);
+        return -1;
+    }
+    freeaddrinfo(ai);
+    return fd;
+}
+
+// Sends the request, reads the response headers. Returns Content-Length, -1 on error;
+// body bytes that came along with the headers are left in body, their count in *extra
+static long request(int fd, const char *host, const char *path, uint8_t *body, size_t *extra) {
+    char req[512];
+    const int n = snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n", path, host);
+    if (send(fd, req, n, 0) != n) {
+        return -1;
+    }
+    static char head[8192];
+    size_t len = 0;
+    char *end = NULL;
+    while (end == NULL) {
+        const ssize_t got = recv(fd, head + len, sizeof(head) - 1 - len, 0);
+        if (got <= 0) {
+            return -1;
+        }
+        len += got;
+        head[len] = '\0';
+        end = strstr(head, "\r\n\r\n");
+        if ((end == NULL) && (len == sizeof(head) - 1)) {
+            return -1;
+        }
+    }
+    long size = -1;
+    for (char *line = strstr(head, "\r\n"); line && line < end; line = strstr(line + 2, "\r\n")) {
+        if (strncasecmp(line + 2, "Content-Length:", 15) == 0) {
+            size = strtol(line + 17, NULL, 10);
+        }
+    }
+    if (strncmp(head + 9, "200", 3) != 0) {
+        return -1;
+    }
+    *extra = len - (end + 4 - head);
+    memcpy(body, end + 4, *extra);
+    return size;
+}
+
+// Old loop: whatever is there, at most a chunk, otherwise delay(1)
+static size_t read_poll(int fd, uint8_t *dst, size_t max, struct stats *st) {
+    for (;;) {
+        int avail = 0;
+        ioctl(fd, FIONREAD, &avail);
+        if (avail > 0) {
+            const ssize_t n = recv(fd, dst, (size_t)avail < max ? (size_t)avail : max, 0);
+            st->reads++;
+            return n > 0 ? (size_t)n : 0;
+        }
+        const struct timespec ms = {0, 1000000};
+        nanosleep(&ms, NULL);
+        st->sleeps++;
+    }
+}
+
+// New loop: sleep until the socket is readable, fill the chunk
+static size_t read_select(int fd, uint8_t *dst, size_t max, struct stats *st) {
+    size_t got = 0;
+    while (got < max) {
+        const ssize_t n = recv(fd, dst + got, max - got, MSG_DONTWAIT);
+        if (n > 0) {
+            got += n;
+            st->reads++;
+            continue;
+        }
+        if (n == 0) {
+            break;
+        }
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(fd, &readable);
+        struct timeval timeout = {STALL_MS / 1000, 0};
+        st->sleeps++;
+        if (select(fd + 1, &readable, NULL, NULL, &timeout) <= 0) {
+            break;
+        }
+    }
+    return got;
+}
+
+static int bench(const char *name, const char *host, const char *port, const char *path, int fetches,
+                 size_t (*read_body)(int, uint8_t *, size_t, struct stats *)) {
+    static uint8_t chunk[CHUNK];
+    struct stats st = {0};
+    const int fd = connect_to(host, port);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to %s:%s, is webserver/server.py running?\n", host, port);
+        return -1;
+    }
+    for (int i = 0; i < fetches; i++) {
+        const double t0 = clock_s(CLOCK_MONOTONIC), c0 = clock_s(CLOCK_THREAD_CPUTIME_ID);
+        size_t have = 0;
+        const long size = request(fd, host, path, chunk, &have);
+        if (size <= 0) {
+            fprintf(stderr, "%s: request %d failed\n", name, i + 1);
+            close(fd);
+            return -1;
+        }
+        size_t received = have;
+        while (received < (size_t)size) {
+            // Chunks line up with the body like the firmware's, the first one holds what came with the headers
+            const size_t want = CHUNK - have < (size_t)size - received ? CHUNK - have : (size_t)size - received;
+            const size_t n = read_body(fd, chunk + have, want, &st);
+            if (n == 0) {
+                fprintf(stderr, "%s: connection lost at %zu of %ld bytes\n", name, received, size);
+                close(fd);
+                return -1;
+            }
+            received += n;
+            have = (have + n) % CHUNK;
+        }
+        st.wall_s += clock_s(CLOCK_MONOTONIC) - t0;
+        st.cpu_s += clock_s(CLOCK_THREAD_CPUTIME_ID) - c0;
+        st.bytes += received;
+        st.fetches++;
+    }
+    close(fd);
+    printf("%-7s %7u %9.0f %9.1f %10.1f %12.2f %9.1f %10.0f\n", name, st.fetches, st.bytes / 1024.0 / st.fetches,
+           st.bytes / 1024.0 / st.wall_s, 1e3 * st.wall_s / st.fetches, 1e3 * st.cpu_s / st.fetches,
+           (double)st.reads / st.fetches, (double)st.sleeps / st.fetches);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *host = (argc > 1) ? argv[1] : "127.0.0.1";
+    const char *port = (argc > 2) ? argv[2] : "8080";
+    const int fetches = (argc > 3) ? atoi(argv[3]) : 20;
+    const char *path = (argc > 4) ? argv[4] : "/picture-frame";
+
+    printf("%d fetches of http://%s:%s%s per reader, receive window %u bytes, %u byte chunks\n\n",
+           fetches, host, port, path, TCP_WND, CHUNK);
+    printf("%-7s %7s %9s %9s %10s %12s %9s %10s\n", "reader", "fetches", "kB/fetch", "kB/s", "ms/fetch",
+           "CPU ms/fetch", "reads", "sleeps");
+    if ((bench("poll", host, port, path, fetches, read_poll) != 0)
+     || (bench("select", host, port, path, fetches, read_select) != 0)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/* bench_mmap.c - Host benchmark of image slots backed by RAM vs. by the mapped flash cache
+ *
+ * Builds src/storage.c, src/volume.cpp and src/image_cache.c for the host, with the flash cache
+ * emulated in a file (flash_file.c) that is mmap'd the way esp_partition_mmap maps the partition.
+ * IMG1.JPG is served from a RAM buffer, IMG2.JPG from the mapping, both holding the same image.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "storage.h"
+#include "image_cache.h"
+#include "flash_file.h"
+
+#define FLASH_SIZE (4 * 1024 * 1024)
+#define IMAGE_LEN  (STORAGE_IMG_SIZE - 1000)
+
+// Biggest request TinyUSB hands to onRead
+#define MAX_BUFSIZE 4096
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Sequential 4 KB reads over the image, like the host reading the file
+static void bench_slot(const char *name, uint32_t slot, int rounds) {
+    static uint8_t buffer[MAX_BUFSIZE];
+    const struct lba_extent *ext = volume_image_extent(slot);
+    const uint32_t sectors = (IMAGE_LEN + DISK_SECTOR_SIZE - 1) / DISK_SECTOR_SIZE;
+    uint64_t requests = 0;
+    const double t0 = now_s();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t s = 0; s < sectors; s += MAX_BUFSIZE / DISK_SECTOR_SIZE) {
+            get_lba_slice(ext->lba + s, buffer, MAX_BUFSIZE);
+            requests++;
+        }
+    }
+    const double dt = now_s() - t0;
+    printf("  %-6s %10.0f req/s  %8.1f MB/s  %6.1f ns/req\n", name,
+           requests / dt, requests * (double)MAX_BUFSIZE / dt / 1e6, dt * 1e9 / requests);
+}
+
+int main(int argc, char *argv[]) {
+    const int rounds = (argc > 1) ? atoi(argv[1]) : 2000;
+    const char *path = "bench_mmap.bin";
+    static uint8_t img[IMAGE_LEN];
+    for (uint32_t i = 0; i < IMAGE_LEN; i++) {
+        img[i] = (uint8_t)(i * 31 + (i >> 11));
+    }
+
+    struct flash_file ff;
+    struct cache_flash flash;
+    unlink(path);
+    if ((flash_file_open(&ff, &flash, path, FLASH_SIZE) != 0) || (flash.map == NULL) || (image_cache_mount(&flash) < 0)) {
+        fprintf(stderr, "Cannot set up the mapped flash file\n");
+        return 1;
+    }
+
+    prepare_files();
+    struct image_buf *buf = storage_image_acquire(0, IMAGE_LEN);
+    memcpy(buf->data, img, IMAGE_LEN);
+    storage_image_publish(0, buf, IMAGE_LEN);
+
+    const void *mapped = NULL;
+    const uint64_t hash = image_cache_hash(img, IMAGE_LEN);
+    if ((image_cache_put(img, IMAGE_LEN) != 0) || (image_cache_map(hash, &mapped) != IMAGE_LEN)) {
+        fprintf(stderr, "Cannot cache the image\n");
+        return 1;
+    }
+    storage_image_publish_mapped(1, mapped, IMAGE_LEN);
+
+    // Both slots must serve identical bytes
+    static uint8_t a[MAX_BUFSIZE], b[MAX_BUFSIZE];
+    for (uint32_t s = 0; s < volume_image_extent(0)->count; s += MAX_BUFSIZE / DISK_SECTOR_SIZE) {
+        get_lba_slice(volume_image_extent(0)->lba + s, a, MAX_BUFSIZE);
+        get_lba_slice(volume_image_extent(1)->lba + s, b, MAX_BUFSIZE);
+        if (memcmp(a, b, MAX_BUFSIZE) != 0) {
+            fprintf(stderr, "Mismatch at sector %u of the image\n", s);
+            return 1;
+        }
+    }
+    printf("RAM and mapped slot serve identical data (%u bytes)\n", IMAGE_LEN);
+
+    // Stream-through: while the image is arriving only the sectors already in flash are served
+    {
+        const struct lba_extent *ext = volume_image_extent(1);
+        const uint32_t half = IMAGE_LEN / 2 + 100;
+        if (image_cache_begin(IMAGE_LEN) != 0) {
+            fprintf(stderr, "Cannot start a streamed put\n");
+            return 1;
+        }
+        storage_image_stream(1, image_cache_pending(), IMAGE_LEN);
+        image_cache_write(img, half);
+        storage_image_stream_progress(1, half);
+        const uint32_t ready = half / DISK_SECTOR_SIZE;
+        const uint32_t got = get_lba_slice(ext->lba + ready - 2, b, MAX_BUFSIZE);
+        const uint32_t none = get_lba_slice(ext->lba + ready, b, MAX_BUFSIZE);
+        image_cache_write(img + half, IMAGE_LEN - half);
+        storage_image_stream_progress(1, IMAGE_LEN);
+        const uint32_t all = get_lba_slice(ext->lba + ready, b, MAX_BUFSIZE);
+        if ((got != 2 * DISK_SECTOR_SIZE) || (none != 0) || (all != MAX_BUFSIZE)
+         || (memcmp(b, img + ready * DISK_SECTOR_SIZE, MAX_BUFSIZE) != 0)) {
+            fprintf(stderr, "Streaming slot served %u/%u/%u bytes\n", got, none, all);
+            return 1;
+        }
+        image_cache_cancel();   // same bytes as the cached image, it stays mapped in slot 1 below
+        storage_image_publish_mapped(1, mapped, IMAGE_LEN);
+        printf("Streaming slot serves just the sectors written so far\n\n");
+    }
+
+    printf("Host reads of the image slot (get_lba_slice, 4 KB):\n");
+    bench_slot("RAM", 0, rounds);
+    bench_slot("mmap", 1, rounds);
+
+    // What mapping saves when a cached image is put into a slot: the copy into RAM
+    static uint8_t copy[STORAGE_IMG_SIZE];
+    const int n = rounds / 20 + 1;
+    double t0 = now_s();
+    for (int i = 0; i < n; i++) {
+        image_cache_read(hash, copy, sizeof(copy));
+    }
+    const double t_read = (now_s() - t0) / n;
+    t0 = now_s();
+    for (int i = 0; i < n; i++) {
+        image_cache_map(hash, &mapped);
+    }
+    const double t_map = (now_s() - t0) / n;
+    printf("\nCached image into a slot:\n");
+    printf("  copy   %8.1f us  (read + CRC, %u bytes of RAM)\n", t_read * 1e6, IMAGE_LEN);
+    printf("  map    %8.1f us  (CRC only, no RAM)\n", t_map * 1e6);
+
+    flash_file_close(&ff);
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,153 @@
+/* bench_packed.c - Host benchmark of packed image slots (STORAGE_IMG_PACKED)
+ *
+ * Builds src/storage.c with STORAGE_IMG_PACKED=1 for the host, packs images into a slot the way
+ * a download does and checks the host reads back exactly the image. Then times the read path,
+ * which now has to decompress, against what USB full speed can carry away.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "storage.h"
+#include "lz4_block.h"
+#include "fallback.h"
+
+#if !STORAGE_IMG_PACKED
+#error "build with -DSTORAGE_IMG_PACKED=1"
+#endif
+
+// Biggest request TinyUSB hands to onRead
+#define MAX_BUFSIZE 4096
+// USB full speed bulk: 19 packets of 64 bytes per 1 ms frame at best
+#define USB_FS_BYTES_PER_S (19.0 * 64 * 1000)
+// Size of the pieces a download arrives in (TCP segment)
+#define SEGMENT 1436
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Sequential reads over the image starting skew sectors in, like the host reading the file
+static double bench_reads(uint32_t len, uint32_t skew, int rounds) {
+    static uint8_t buffer[MAX_BUFSIZE];
+    const struct lba_extent *ext = volume_image_extent(0);
+    const uint32_t sectors = (len + DISK_SECTOR_SIZE - 1) / DISK_SECTOR_SIZE;
+    uint64_t bytes = 0;
+    const double t0 = now_s();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t s = skew; s < sectors; s += MAX_BUFSIZE / DISK_SECTOR_SIZE) {
+            bytes += get_lba_slice(ext->lba + s, buffer, MAX_BUFSIZE);
+        }
+    }
+    return bytes / (now_s() - t0);
+}
+
+// Raw decompression speed of the image's compressed blocks
+static double bench_unpack(const uint8_t *img, uint32_t len, int rounds) {
+    static uint8_t packed[(STORAGE_IMG_SIZE / STORAGE_IMG_BLOCK + 1) * STORAGE_IMG_BLOCK];
+    static uint32_t sizes[STORAGE_IMG_SIZE / STORAGE_IMG_BLOCK + 1];
+    static uint8_t out[STORAGE_IMG_BLOCK];
+    uint32_t blocks = 0;
+    uint64_t bytes = 0;
+    for (uint32_t off = 0; off < len && blocks < sizeof(sizes) / sizeof(sizes[0]); off += STORAGE_IMG_BLOCK) {
+        const uint32_t n = (len - off < STORAGE_IMG_BLOCK) ? len - off : STORAGE_IMG_BLOCK;
+        sizes[blocks] = lz4_block_compress(img + off, n, packed + blocks * STORAGE_IMG_BLOCK, STORAGE_IMG_BLOCK);
+        blocks += (sizes[blocks] > 0);
+    }
+    if (blocks == 0) {
+        return 0;
+    }
+    const double t0 = now_s();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t b = 0; b < blocks; b++) {
+            bytes += lz4_block_decompress(packed + b * STORAGE_IMG_BLOCK, sizes[b], out, sizeof(out));
+        }
+    }
+    return bytes / (now_s() - t0);
+}
+
+static int bench_image(const char *name, const uint8_t *img, uint32_t len, int rounds) {
+    struct image_buf *buf = storage_image_acquire(0, len);
+    for (uint32_t off = 0; off < len; off += SEGMENT) {
+        if (storage_image_append(buf, img + off, (len - off < SEGMENT) ? len - off : SEGMENT) != 0) {
+            printf("%-34.34s %7u bytes, does not fit %u bytes packed\n", name, len, buf->size);
+            return 0;
+        }
+    }
+    storage_image_publish(0, buf, len);
+
+    // Whole file, including the zeros behind the image, must read back unchanged
+    static uint8_t sector[MAX_BUFSIZE];
+    const struct lba_extent *ext = volume_image_extent(0);
+    for (uint32_t s = 0; s < ext->count; s++) {
+        const uint32_t off = s * DISK_SECTOR_SIZE;
+        uint8_t expect[DISK_SECTOR_SIZE] = {0};
+        if (off < len) {
+            memcpy(expect, img + off, (len - off < DISK_SECTOR_SIZE) ? len - off : DISK_SECTOR_SIZE);
+        }
+        if ((get_lba_slice(ext->lba + s, sector, DISK_SECTOR_SIZE) != DISK_SECTOR_SIZE)
+         || (memcmp(sector, expect, DISK_SECTOR_SIZE) != 0)) {
+            fprintf(stderr, "%s: sector %u reads back wrong\n", name, s);
+            return -1;
+        }
+    }
+
+    // Reads 2 KB off the blocks, like a host reading 4 KB at a time from a FAT of 2 KB clusters
+    const double reads = bench_reads(len, 4, rounds);
+    const double unpack = bench_unpack(img, len, rounds);
+    const double worst = (unpack > 0) && (unpack < reads) ? unpack : reads;
+    printf("%-34.34s %7u %7u %5.1f%% %10.1f %11.1f %9.0fx\n", name, len, buf->stored, 100.0 * buf->stored / len,
+           reads / 1e6, unpack / 1e6, worst / USB_FS_BYTES_PER_S);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const int rounds = (argc > 1) ? atoi(argv[1]) : 200;
+    prepare_files();
+
+    printf("Packed slot of %u bytes, %u byte blocks, %u cached unpacked; USB full speed moves %.2f MB/s\n",
+           STORAGE_IMG_SIZE, STORAGE_IMG_BLOCK, STORAGE_IMG_BLOCK_CACHE, USB_FS_BYTES_PER_S / 1e6);
+    printf("reads: sequential 4 KB requests through get_lba_slice, unpack: every compressed block decompressed\n\n");
+    printf("%-34s %7s %7s %6s %10s %11s %10s\n", "image", "bytes", "stored", "", "reads MB/s", "unpack MB/s", "x USB FS");
+
+    int err = 0;
+    for (uint32_t i = 0; i < fallback_count(); i++) {
+        static uint8_t img[STORAGE_IMG_FILE_SIZE];
+        const uint32_t len = fallback_size(i);
+        char name[32];
+        for (uint32_t b = 0; b * STORAGE_IMG_BLOCK < len && len <= sizeof(img); b++) {
+            fallback_read_block(i, b, img + b * STORAGE_IMG_BLOCK);
+        }
+        snprintf(name, sizeof(name), "fallback %u", i + 1);
+        err |= bench_image(name, img, len, rounds);
+    }
+
+    // Hardest case for the decompressor: compressible, but only in short matches
+    static uint8_t noise[96 * 1024];
+    uint32_t x = 1;
+    for (uint32_t i = 0; i < sizeof(noise); i++) {
+        x = x * 1103515245u + 12345u;
+        noise[i] = "JPEG-flat-area.."[(x >> 16) & 15];
+    }
+    err |= bench_image("16 symbol noise (synthetic)", noise, sizeof(noise), rounds);
+
+    for (int i = 2; i < argc; i++) {
+        FILE *f = fopen(argv[i], "rb");
+        if (f == NULL) {
+            perror(argv[i]);
+            return 1;
+        }
+        static uint8_t img[STORAGE_IMG_FILE_SIZE];
+        const uint32_t len = (uint32_t)fread(img, 1, sizeof(img), f);
+        fclose(f);
+        const char *name = strrchr(argv[i], '/');
+        err |= bench_image(name ? name + 1 : argv[i], img, len, rounds);
+    }
+    return err ? 1 : 0;
+}
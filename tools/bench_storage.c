@@ -0,0 +1,184 @@
+/* bench_storage.c - Host micro-benchmark of the LBA read path (get_lba_slice) in src/storage.c */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "storage.h"
+
+extern unsigned char FILE_CREDS_JSN[4 * DISK_SECTOR_SIZE];
+
+// Image buffers published at startup
+static const unsigned char *FILE_IMG1_JPG;
+static const unsigned char *FILE_IMG2_JPG;
+
+// Highest LBA the host reads during a slideshow (end of IMG2.JPG)
+#define LBA_END 2668
+
+// Biggest request TinyUSB hands to onRead
+#define MAX_BUFSIZE 4096
+
+// Snapshot of the filesystem sectors, for the reference implementation
+static uint8_t DISK_MBR[DISK_SECTOR_SIZE];
+static uint8_t DISK_VBR[DISK_SECTOR_SIZE];
+static uint8_t DISK_FAT[DISK_SECTOR_SIZE];
+static uint8_t DISK_ROOTDIR[DISK_SECTOR_SIZE];
+
+typedef uint32_t (*read_fn)(uint32_t lba, void *buffer, uint32_t bufsize);
+
+
+// Reference: the original per-sector if-chain, for comparison
+static void *legacy_get_file_lba(uint32_t offset, void *buffer, const unsigned char data[], uint32_t len) {
+    const int32_t rest = len - offset;
+    if (rest >= DISK_SECTOR_SIZE) {
+        memcpy(buffer, &data[offset], DISK_SECTOR_SIZE);
+        return buffer;
+    }
+    if (rest > 0) {
+        memcpy(buffer, &data[offset], rest);
+        memset((uint8_t *)buffer + rest, 0, DISK_SECTOR_SIZE - rest);
+        return buffer;
+    }
+    memset(buffer, 0, DISK_SECTOR_SIZE);
+    return buffer;
+}
+
+static void *legacy_get_lba(uint32_t lba, void *buffer) {
+    if (lba == 0) {
+        memcpy(buffer, DISK_MBR, DISK_SECTOR_SIZE);
+        return buffer;
+    }
+    if (lba == 2048) {
+        memcpy(buffer, DISK_VBR, DISK_SECTOR_SIZE);
+        return buffer;
+    }
+    if ((lba == 2052) || (lba == 2084)) {
+        memcpy(buffer, DISK_FAT, DISK_SECTOR_SIZE);
+        return buffer;
+    }
+    if (lba == 2116) {
+        memcpy(buffer, DISK_ROOTDIR, DISK_SECTOR_SIZE);
+        return buffer;
+    }
+    if ((lba >= 2152) && (lba < 2156)) {
+        return legacy_get_file_lba(DISK_SECTOR_SIZE * (lba - 2152), buffer, FILE_CREDS_JSN, 4 * DISK_SECTOR_SIZE);
+    }
+    if ((lba >= 2156) && (lba < 2412)) {
+        return legacy_get_file_lba(DISK_SECTOR_SIZE * (lba - 2156), buffer, FILE_IMG1_JPG, 256 * DISK_SECTOR_SIZE);
+    }
+    if ((lba >= 2412) && (lba < 2668)) {
+        return legacy_get_file_lba(DISK_SECTOR_SIZE * (lba - 2412), buffer, FILE_IMG2_JPG, 256 * DISK_SECTOR_SIZE);
+    }
+    memset(buffer, 0, DISK_SECTOR_SIZE);
+    return buffer;
+}
+
+static uint32_t legacy_get_lba_slice(uint32_t lba, void *buffer, uint32_t bufsize) {
+    int32_t num = (int32_t)bufsize;
+    while (num > 0) {
+        legacy_get_lba(lba++, buffer);
+        buffer = (uint8_t *)buffer + DISK_SECTOR_SIZE;
+        num -= DISK_SECTOR_SIZE;
+    }
+    return bufsize;
+}
+
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Sequential 4 KB reads over the whole used LBA range, like a host reading the files
+static void bench_sequential(const char *name, read_fn fn, int rounds) {
+    static uint8_t buffer[MAX_BUFSIZE];
+    uint64_t requests = 0;
+    const double t0 = now_s();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t lba = 0; lba + MAX_BUFSIZE / DISK_SECTOR_SIZE <= LBA_END; lba += MAX_BUFSIZE / DISK_SECTOR_SIZE) {
+            fn(lba, buffer, MAX_BUFSIZE);
+            requests++;
+        }
+    }
+    const double dt = now_s() - t0;
+    printf("  %-8s sequential:  %10.0f req/s  %8.1f MB/s  %6.1f ns/req\n", name,
+           requests / dt, requests * (double)MAX_BUFSIZE / dt / 1e6, dt * 1e9 / requests);
+}
+
+// Random requests of 1..8 sectors at random LBAs within the used range
+static void bench_random(const char *name, read_fn fn, int requests) {
+    static uint8_t buffer[MAX_BUFSIZE];
+    static uint32_t lbas[4096];
+    static uint32_t sizes[4096];
+    srand(1);
+    for (int i = 0; i < 4096; i++) {
+        sizes[i] = (1 + rand() % (MAX_BUFSIZE / DISK_SECTOR_SIZE)) * DISK_SECTOR_SIZE;
+        lbas[i] = rand() % (LBA_END - sizes[i] / DISK_SECTOR_SIZE);
+    }
+    uint64_t bytes = 0;
+    const double t0 = now_s();
+    for (int i = 0; i < requests; i++) {
+        fn(lbas[i & 4095], buffer, sizes[i & 4095]);
+        bytes += sizes[i & 4095];
+    }
+    const double dt = now_s() - t0;
+    printf("  %-8s random:      %10.0f req/s  %8.1f MB/s  %6.1f ns/req\n", name,
+           requests / dt, bytes / dt / 1e6, dt * 1e9 / requests);
+}
+
+// Both implementations must return identical bytes
+static int verify(void) {
+    static uint8_t a[MAX_BUFSIZE], b[MAX_BUFSIZE];
+    for (uint32_t lba = 0; lba < LBA_END + 8; lba++) {
+        for (uint32_t size = DISK_SECTOR_SIZE; size <= MAX_BUFSIZE; size += DISK_SECTOR_SIZE) {
+            memset(a, 0xA5, sizeof(a));
+            memset(b, 0x5A, sizeof(b));
+            legacy_get_lba_slice(lba, a, size);
+            get_lba_slice(lba, b, size);
+            if (memcmp(a, b, size) != 0) {
+                fprintf(stderr, "Error: mismatch at LBA %u, bufsize %u\n", lba, size);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const int rounds = (argc > 1) ? atoi(argv[1]) : 2000;
+
+    prepare_files();
+    for (uint32_t slot = 0; slot < 2; slot++) {
+        struct image_buf *img = storage_image_acquire(slot, 0);
+        for (size_t i = 0; i < img->size; i++) {
+            img->data[i] = (uint8_t)(i * (7 + slot));
+        }
+        storage_image_publish(slot, img, img->size);
+    }
+    FILE_IMG1_JPG = storage_image_front(0)->data;
+    FILE_IMG2_JPG = storage_image_front(1)->data;
+    get_lba_slice(0, DISK_MBR, DISK_SECTOR_SIZE);
+    get_lba_slice(2048, DISK_VBR, DISK_SECTOR_SIZE);
+    get_lba_slice(2052, DISK_FAT, DISK_SECTOR_SIZE);
+    get_lba_slice(2116, DISK_ROOTDIR, DISK_SECTOR_SIZE);
+    for (size_t i = 0; i < 4 * DISK_SECTOR_SIZE; i++) {
+        FILE_CREDS_JSN[i] = (uint8_t)i;
+    }
+
+    if (verify() != 0) {
+        return 1;
+    }
+    printf("Output of get_lba_slice matches the reference implementation\n\n");
+
+    printf("Per-sector if-chain (before):\n");
+    bench_sequential("legacy", legacy_get_lba_slice, rounds);
+    bench_random("legacy", legacy_get_lba_slice, rounds * 333);
+    printf("\nExtent table (after):\n");
+    bench_sequential("extent", get_lba_slice, rounds);
+    bench_random("extent", get_lba_slice, rounds * 333);
+    return 0;
+}
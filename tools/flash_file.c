@@ -0,0 +1,128 @@
+/* flash_file.c - NOR flash emulated in a file
+ *
+ * Same rules as the SPI flash behind esp_partition: erase works on whole 4 KB sectors and
+ * sets them to 0xFF, writes can only clear bits. Violations fail loudly, so a cache that
+ * passes here doesn't silently rely on rewriting flash in place.
+ * The file is mapped read-only as well, like esp_partition_mmap maps the partition.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "flash_file.h"
+
+static int ff_read(void *ctx, uint32_t addr, void *buf, uint32_t len) {
+    struct flash_file *ff = ctx;
+    if ((uint64_t)addr + len > ff->size) {
+        return -1;
+    }
+    return (pread(ff->fd, buf, len, addr) == (ssize_t)len) ? 0 : -1;
+}
+
+static int ff_write(void *ctx, uint32_t addr, const void *buf, uint32_t len) {
+    struct flash_file *ff = ctx;
+    if ((uint64_t)addr + len > ff->size) {
+        return -1;
+    }
+    uint8_t old[IMAGE_CACHE_SECTOR];
+    const uint8_t *src = buf;
+    while (len > 0) {
+        uint32_t n = (len < sizeof(old)) ? len : sizeof(old);
+        if (ff->fail_after >= 0 && n > ff->fail_after) {
+            n = (uint32_t)ff->fail_after;   // power cut: write what made it, then fail
+        }
+        if (pread(ff->fd, old, n, addr) != (ssize_t)n) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            if ((old[i] & src[i]) != src[i]) {
+                fprintf(stderr, "flash_file: write to 0x%06x sets bits, sector not erased\n", addr + i);
+                return -1;
+            }
+        }
+        if (pwrite(ff->fd, src, n, addr) != (ssize_t)n) {
+            return -1;
+        }
+        if (ff->fail_after >= 0) {
+            ff->fail_after -= n;
+            if (ff->fail_after == 0) {
+                return -1;
+            }
+        }
+        addr += n;
+        src += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int ff_erase(void *ctx, uint32_t addr, uint32_t len) {
+    struct flash_file *ff = ctx;
+    if ((addr % IMAGE_CACHE_SECTOR) || (len % IMAGE_CACHE_SECTOR) || ((uint64_t)addr + len > ff->size)) {
+        fprintf(stderr, "flash_file: erase 0x%06x+0x%x not sector aligned\n", addr, len);
+        return -1;
+    }
+    uint8_t blank[IMAGE_CACHE_SECTOR];
+    memset(blank, 0xFF, sizeof(blank));
+    for (uint32_t a = addr; a < addr + len; a += IMAGE_CACHE_SECTOR) {
+        if (pwrite(ff->fd, blank, sizeof(blank), a) != (ssize_t)sizeof(blank)) {
+            return -1;
+        }
+        ff->erase_count[a / IMAGE_CACHE_SECTOR]++;
+    }
+    return 0;
+}
+
+int flash_file_open(struct flash_file *ff, struct cache_flash *flash, const char *path, uint32_t size) {
+    memset(ff, 0, sizeof(*ff));
+    ff->fail_after = -1;
+    ff->size = size;
+    ff->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (ff->fd < 0) {
+        perror("flash_file: open");
+        return -1;
+    }
+    struct stat st;
+    fstat(ff->fd, &st);
+    if (st.st_size < (off_t)size) {
+        // Fresh chip: everything erased
+        uint8_t blank[IMAGE_CACHE_SECTOR];
+        memset(blank, 0xFF, sizeof(blank));
+        for (uint32_t a = (uint32_t)st.st_size & ~(IMAGE_CACHE_SECTOR - 1); a < size; a += IMAGE_CACHE_SECTOR) {
+            if (pwrite(ff->fd, blank, sizeof(blank), a) != (ssize_t)sizeof(blank)) {
+                perror("flash_file: init");
+                close(ff->fd);
+                return -1;
+            }
+        }
+    }
+    ff->erase_count = calloc(size / IMAGE_CACHE_SECTOR, sizeof(uint32_t));
+    ff->map = mmap(NULL, size, PROT_READ, MAP_SHARED, ff->fd, 0);
+    if (ff->map == MAP_FAILED) {
+        ff->map = NULL;
+    }
+
+    flash->size = size;
+    flash->read = ff_read;
+    flash->write = ff_write;
+    flash->erase = ff_erase;
+    flash->ctx = ff;
+    flash->map = ff->map;
+    return 0;
+}
+
+void flash_file_close(struct flash_file *ff) {
+    if (ff->map != NULL) {
+        munmap((void *)ff->map, ff->size);
+        ff->map = NULL;
+    }
+    close(ff->fd);
+    free(ff->erase_count);
+    ff->erase_count = NULL;
+}
@@ -0,0 +1,21 @@
+/* flash_file.h - NOR flash emulated in a file, backend for host builds of src/image_cache.c */
+
+#ifndef FLASH_FILE_H
+#define FLASH_FILE_H
+
+#include <stdint.h>
+#include "image_cache.h"
+
+struct flash_file {
+    int fd;
+    uint32_t size;
+    uint32_t *erase_count;  // per sector
+    int64_t fail_after;     // bytes written until a simulated power cut, -1: never
+    const uint8_t *map;     // the file mapped read-only, NULL if mmap failed
+};
+
+// Opens path as flash of size bytes, creates it erased (all 0xFF) if missing. Returns 0 on success
+int flash_file_open(struct flash_file *ff, struct cache_flash *flash, const char *path, uint32_t size);
+void flash_file_close(struct flash_file *ff);
+
+#endif /* FLASH_FILE_H */
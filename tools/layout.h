@@ -0,0 +1,53 @@
+/* layout.h - On-disk structures of MBR, VBR and FAT directory entries (all little-endian) */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+
+#define DISK_SECTOR_SIZE 512
+
+struct partition_entry {
+    uint8_t  boot_indicator;        // 0x80 = bootable
+    uint8_t  starting_head;
+    uint8_t  starting_sector;       // bits 0-5 sector, bits 6-7 cylinder high bits
+    uint8_t  starting_cylinder;
+    uint8_t  partition_type;
+    uint8_t  ending_head;
+    uint8_t  ending_sector;
+    uint8_t  ending_cylinder;
+    uint32_t starting_lba;
+    uint32_t size_in_sectors;
+} __attribute__((packed));
+
+struct mbr {
+    uint8_t  mbr_boot_code[446];
+    struct partition_entry partition_table[4];
+    uint16_t boot_signature;        // 0xAA55
+} __attribute__((packed));
+
+struct vbr {
+    uint8_t  vbr_jump_instruction[3];
+    uint8_t  vbr_oem_identifier[8];
+    uint8_t  vbr_bpb[25];           // BIOS Parameter Block
+    uint8_t  vbr_ebr[54];           // Extended Boot Record (FAT32 sized)
+    uint8_t  vbr_boot_code[420];
+    uint16_t vbr_boot_signature;    // 0xAA55
+} __attribute__((packed));
+
+struct directory_record {
+    uint8_t  name[11];              // 8.3, space padded
+    uint8_t  attributes;
+    uint8_t  reserved;
+    uint8_t  creation_time_tenths;
+    uint16_t creation_time;
+    uint16_t creation_date;
+    uint16_t last_access_date;
+    uint16_t first_cluster_high;
+    uint16_t last_mod_time;
+    uint16_t last_mod_date;
+    uint16_t first_cluster_low;
+    uint32_t file_size;
+} __attribute__((packed));
+
+#endif /* LAYOUT_H */
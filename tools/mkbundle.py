@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""
+Build the fallback image bundle compiled into the firmware (src/fallback_bundle.c).
+
+Every JPEG is cut into 4 KB blocks and each block LZ4 compressed on its own, so the
+device unpacks any block without the ones before it (src/fallback.c reads the bundle).
+Blocks that don't shrink are stored as they are.
+
+Standalone:  tools/mkbundle.py [-o src/fallback_bundle.c] [image.jpg ...]
+PlatformIO:  extra_scripts = pre:tools/mkbundle.py  (bundles fallback/*.jpg before each build)
+
+Bundle layout, all numbers 32 bit little endian:
+    magic "FBN1", number of images
+    per image: offset of its data in the bundle, length unpacked
+    per image data: one index entry per block (end of the block's bytes, relative to
+    the end of the index, bit 31 set if stored as is), then the blocks
+"""
+
+import argparse
+import glob
+import os
+import struct
+
+BLOCK         = 4096
+MAGIC         = b"FBN1"
+RAW           = 0x80000000
+MIN_MATCH     = 4
+LAST_LITERALS = 5
+MATCH_LIMIT   = 12
+MAX_OFFSET    = 65535
+
+
+def _length(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def _sequence(out, literals, offset=0, match=0):
+    token = min(len(literals), 15) << 4
+    if offset:
+        token |= min(match - MIN_MATCH, 15)
+    out.append(token)
+    if len(literals) >= 15:
+        _length(out, len(literals) - 15)
+    out += literals
+    if offset:
+        out += struct.pack("<H", offset)
+        if match - MIN_MATCH >= 15:
+            _length(out, match - MIN_MATCH - 15)
+
+
+def lz4_block(src):
+    """LZ4 block format, greedy, like lz4_block_compress() in src/lz4_block.c"""
+    out    = bytearray()
+    last   = {}
+    anchor = 0
+    i      = 0
+    while i <= len(src) - MATCH_LIMIT:
+        key = src[i:i + MIN_MATCH]
+        ref = last.get(key)
+        last[key] = i
+        if ref is None or i - ref > MAX_OFFSET:
+            i += 1
+            continue
+        m = i + MIN_MATCH
+        while m < len(src) - LAST_LITERALS and src[m] == src[ref + m - i]:
+            m += 1
+        _sequence(out, src[anchor:i], i - ref, m - i)
+        i = anchor = m
+    _sequence(out, src[anchor:])
+    return bytes(out)
+
+
+def pack_image(data):
+    index  = []
+    blocks = bytearray()
+    for start in range(0, len(data), BLOCK):
+        block  = data[start:start + BLOCK]
+        packed = lz4_block(block)
+        if len(packed) < len(block):
+            blocks += packed
+            index.append(len(blocks))
+        else:
+            blocks += block
+            index.append(len(blocks) | RAW)
+    return struct.pack(f"<{len(index)}I", *index) + bytes(blocks)
+
+
+def build_bundle(paths):
+    images = []
+    for path in paths:
+        with open(path, "rb") as f:
+            images.append(f.read())
+    offset = 8 + 8 * len(images)
+    header = MAGIC + struct.pack("<I", len(images))
+    body   = bytearray()
+    for data in images:
+        header += struct.pack("<II", offset + len(body), len(data))
+        body   += pack_image(data)
+    return header + bytes(body), sum(len(d) for d in images)
+
+
+def c_source(bundle, paths, unpacked):
+    names = ", ".join(os.path.basename(p) for p in paths) or "none"
+    lines = [
+        "// Fallback images, generated by tools/mkbundle.py - do not edit",
+        f"// {len(paths)} images ({names})",
+        f"// {unpacked} bytes, packed to {len(bundle)} bytes",
+        "const unsigned char FALLBACK_BUNDLE[] = {",
+    ]
+    for i in range(0, len(bundle), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in bundle[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append(f"const unsigned int FALLBACK_BUNDLE_len = {len(bundle)};")
+    return "\n".join(lines) + "\n"
+
+
+def write_bundle(paths, out):
+    bundle, unpacked = build_bundle(paths)
+    source = c_source(bundle, paths, unpacked)
+    # Unchanged bundle: leave the file alone, so it isn't rebuilt
+    if os.path.exists(out):
+        with open(out) as f:
+            if f.read() == source:
+                return bundle, unpacked, False
+    with open(out, "w") as f:
+        f.write(source)
+    return bundle, unpacked, True
+
+
+def default_images(root):
+    folder = os.path.join(root, "fallback")
+    return sorted(glob.glob(os.path.join(folder, "*.jpg")) + glob.glob(os.path.join(folder, "*.jpeg")))
+
+
+def default_output(root):
+    return os.path.join(root, "src", "fallback_bundle.c")
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(
+        description="Build the fallback image bundle compiled into the firmware"
+    )
+    parser.add_argument("images", nargs="*",
+                        help="JPEG files (default: fallback/*.jpg)")
+    parser.add_argument("-o", "--output", default=default_output(root),
+                        help="C file to write (default: src/fallback_bundle.c)")
+    args = parser.parse_args()
+
+    paths = args.images or default_images(root)
+    bundle, unpacked, written = write_bundle(paths, args.output)
+    print(f"{args.output}: {len(paths)} images, {unpacked:,} bytes packed to {len(bundle):,}"
+          + ("" if written else " (unchanged)"))
+
+
+if __name__ == "__main__":
+    main()
+elif "Import" in globals():
+    # PlatformIO extra script, run by SCons (which doesn't set __file__)
+    Import("env")  # noqa: F821
+    _root  = env.subst("$PROJECT_DIR")  # noqa: F821
+    _paths = default_images(_root)
+    _bundle, _unpacked, _ = write_bundle(_paths, default_output(_root))
+    print(f"Fallback bundle: {len(_paths)} images, {_unpacked:,} bytes packed to {len(_bundle):,}")
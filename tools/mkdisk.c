@@ -0,0 +1,62 @@
+/* mkdisk.c - Dump the virtual disk the firmware serves over USB into a binary image file */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "storage.h"
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s <image_file> [jpeg_file]\n", argv[0]);
+        fprintf(stderr, "  Writes the virtual disk (LBA 0 up to the end of the last file) to <image_file>\n");
+        fprintf(stderr, "  If given, <jpeg_file> is published into every image slot, like a completed HTTP fetch\n");
+        fprintf(stderr, "  Example: %s disk.img ../webserver/assets/kadres-cat-2451820_1920.jpg\n", argv[0]);
+        return 1;
+    }
+
+    prepare_files();
+
+    if (argc == 3) {
+        FILE *jpg = fopen(argv[2], "rb");
+        if (!jpg) {
+            perror("Error opening jpeg file");
+            return 1;
+        }
+        size_t len = 0;
+        for (uint32_t slot = 0; slot < VOLUME_IMAGES; slot++) {
+            struct image_buf *buf = storage_image_acquire(slot, 0);
+            rewind(jpg);
+            len = fread(buf->data, 1, buf->size, jpg);
+            storage_image_publish(slot, buf, len);
+        }
+        fclose(jpg);
+        printf("Published %s (%zu bytes)\n", argv[2], len);
+    }
+
+    const struct lba_extent *last = &DISK_EXTENTS[DISK_EXTENTS_NUM - 1];
+    const uint32_t sectors = last->lba + last->count;
+
+    FILE *fp = fopen(argv[1], "wb");
+    if (!fp) {
+        perror("Error creating image file");
+        return 1;
+    }
+    static uint8_t buffer[4096];
+    for (uint32_t lba = 0; lba < sectors; lba += sizeof(buffer) / DISK_SECTOR_SIZE) {
+        uint32_t n = sectors - lba;
+        if (n > sizeof(buffer) / DISK_SECTOR_SIZE) {
+            n = sizeof(buffer) / DISK_SECTOR_SIZE;
+        }
+        get_lba_slice(lba, buffer, n * DISK_SECTOR_SIZE);
+        if (fwrite(buffer, DISK_SECTOR_SIZE, n, fp) != n) {
+            perror("Error writing image file");
+            fclose(fp);
+            return 1;
+        }
+    }
+    fclose(fp);
+
+    printf("Wrote %s: %u sectors (%u bytes)\n", argv[1], sectors, sectors * DISK_SECTOR_SIZE);
+    return 0;
+}
@@ -0,0 +1,217 @@
+/* replay_trace.c - Read an LBA trace exported by "get trace hex" and replay it on the host build
+ *
+ * Takes the serial console log (everything outside the trace markers is skipped) or the binary export.
+ * Prints how the host read the disk: request sizes, offsets, which structures and files, and when it
+ * opened each image. Then replays the reads through get_lba_slice() of src/storage.c with the fallback
+ * images in the slots, and times them.
+ *
+ * The volume layout is the one this tool is built with: build it with the firmware's STORAGE_IMG_* flags.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "lba_trace.h"
+#include "storage.h"
+
+#define MAX_ENTRIES (1 << 20)
+#define MAX_BUFSIZE 4096
+#define MAX_REGIONS 32
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int hex_digit(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Binary export from the file: as it is, or hex decoded from between the markers of a console log
+static uint8_t *load(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(size + 1);
+    if ((data == NULL) || (fread(data, 1, size, f) != (size_t)size)) {
+        fclose(f);
+        free(data);
+        return NULL;
+    }
+    fclose(f);
+    data[size] = '\0';
+    if ((size >= 4) && (memcmp(data, LBA_TRACE_MAGIC, 4) == 0)) {
+        *len = size;
+        return data;
+    }
+
+    const char *p = strstr((const char *)data, LBA_TRACE_BEGIN);
+    const char *end = p ? strstr(p, LBA_TRACE_END) : NULL;
+    if (end == NULL) {
+        fprintf(stderr, "%s: no trace between %s and %s\n", path, LBA_TRACE_BEGIN, LBA_TRACE_END);
+        free(data);
+        return NULL;
+    }
+    size_t n = 0;
+    int high = -1;
+    for (p += strlen(LBA_TRACE_BEGIN); p < end; p++) {
+        const int d = hex_digit(*p);
+        if (d < 0) {
+            continue;   // line ends
+        }
+        if (high < 0) {
+            high = d;
+        } else {
+            data[n++] = (uint8_t)(high << 4 | d);   // decoded bytes never overtake the text
+            high = -1;
+        }
+    }
+    *len = n;
+    return data;
+}
+
+struct region {
+    const char *name;
+    uint32_t reads;
+    uint64_t bytes;
+};
+
+int main(int argc, char *argv[]) {
+    int verbose = 0;
+    int arg = 1;
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) {
+        verbose = 1;
+        arg++;
+    }
+    if (arg >= argc) {
+        fprintf(stderr, "Usage: %s [-v] <console log or binary trace>\n", argv[0]);
+        return 1;
+    }
+
+    size_t len;
+    uint8_t *data = load(argv[arg], &len);
+    if (data == NULL) {
+        return 1;
+    }
+    struct lba_trace_header header;
+    if ((len < sizeof(header)) || (memcpy(&header, data, sizeof(header)), memcmp(header.magic, LBA_TRACE_MAGIC, 4) != 0)
+     || (header.version != LBA_TRACE_VERSION) || (header.entry_size != sizeof(struct lba_trace_entry))) {
+        fprintf(stderr, "%s: not an LBA trace of version %u\n", argv[arg], LBA_TRACE_VERSION);
+        return 1;
+    }
+    uint32_t count = (uint32_t)((len - sizeof(header)) / sizeof(struct lba_trace_entry));
+    if (count != header.count) {
+        fprintf(stderr, "%s: header says %u entries, found %u\n", argv[arg], header.count, count);
+        count = (count < header.count) ? count : header.count;
+    }
+    if (count > MAX_ENTRIES) {
+        count = MAX_ENTRIES;
+    }
+    const struct lba_trace_entry *entries = (const struct lba_trace_entry *)(data + sizeof(header));
+
+    prepare_files();
+
+    // How the host reads
+    uint32_t reads = 0, writes = 0, offsets = 0, short_reads = 0, sizes[MAX_BUFSIZE / DISK_SECTOR_SIZE + 1] = {0};
+    struct region regions[MAX_REGIONS] = {{0}};
+    uint32_t num_regions = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const struct lba_trace_entry *e = &entries[i];
+        if (e->bufsize == 0) {
+            continue;   // overwritten while exporting
+        }
+        uint32_t sector;
+        const char *name = volume_lba_name(e->lba, &sector);
+        if (verbose) {
+            printf("%8u %10u %c %7u %4u %4u %4u  %s+%u\n", header.first + i, e->t_us, e->op ? 'W' : 'R', e->lba,
+                   e->bufsize, e->offset, e->result, name ? name : "-", sector);
+        }
+        if (e->op == LBA_TRACE_WRITE) {
+            writes++;
+            continue;
+        }
+        reads++;
+        offsets += (e->offset != 0);
+        short_reads += (e->result < e->bufsize);
+        sizes[(e->bufsize <= MAX_BUFSIZE) ? e->bufsize / DISK_SECTOR_SIZE : 0]++;
+        uint32_t r = 0;
+        while ((r < num_regions) && (regions[r].name != name)) {
+            r++;
+        }
+        if ((r == num_regions) && (num_regions < MAX_REGIONS)) {
+            regions[num_regions++].name = name;
+        }
+        if (r < num_regions) {
+            regions[r].reads++;
+            regions[r].bytes += e->bufsize;
+        }
+    }
+    const double span = count ? (uint32_t)(entries[count - 1].t_us - entries[0].t_us) * 1e-6 : 0;
+    printf("%u entries (from %u on) over %.3f s: %u reads, %u writes\n", count, header.first, span, reads, writes);
+    printf("Offset not 0: %u, short reads (image still arriving): %u\n", offsets, short_reads);
+    printf("Request sizes:");
+    for (uint32_t s = 1; s <= MAX_BUFSIZE / DISK_SECTOR_SIZE; s++) {
+        if (sizes[s]) {
+            printf("  %u B: %u", s * DISK_SECTOR_SIZE, sizes[s]);
+        }
+    }
+    printf(sizes[0] ? "  other: %u\n" : "\n", sizes[0]);
+    printf("Reads per region:\n");
+    for (uint32_t r = 0; r < num_regions; r++) {
+        printf("  %-10s %7u reads %10llu bytes\n", regions[r].name ? regions[r].name : "(unused)",
+               regions[r].reads, (unsigned long long)regions[r].bytes);
+    }
+
+    // When the host opened each image (read its first sector), the cadence the fetch trigger follows
+    printf("Image opens:\n");
+    uint32_t opens = 0, t_last = 0;
+    double interval_sum = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        const struct lba_trace_entry *e = &entries[i];
+        for (uint32_t image = 0; (e->bufsize > 0) && (e->op == LBA_TRACE_READ) && (image < VOLUME_IMAGES); image++) {
+            if (e->lba != volume_image_extent(image)->lba) {
+                continue;
+            }
+            const double dt = opens ? (uint32_t)(e->t_us - t_last) * 1e-6 : 0;
+            printf("  %10.3f s  IMG%u.JPG", (uint32_t)(e->t_us - entries[0].t_us) * 1e-6, image + 1);
+            printf(opens ? "  +%.3f s\n" : "\n", dt);
+            interval_sum += dt;
+            t_last = e->t_us;
+            opens++;
+        }
+    }
+    if (opens > 1) {
+        printf("  %u opens, every %.3f s on average\n", opens, interval_sum / (opens - 1));
+    }
+
+    // Replay the reads against the host build, as fast as they go
+    static uint8_t buffer[MAX_BUFSIZE];
+    uint32_t replayed = 0, differ = 0;
+    const double t0 = now_s();
+    for (uint32_t i = 0; i < count; i++) {
+        const struct lba_trace_entry *e = &entries[i];
+        if ((e->op != LBA_TRACE_READ) || (e->bufsize == 0) || (e->bufsize > MAX_BUFSIZE)) {
+            continue;
+        }
+        differ += (get_lba_slice(e->lba, buffer, e->bufsize) != e->result);
+        replayed++;
+    }
+    const double dt = now_s() - t0;
+    printf("Replayed %u reads in %.3f ms (%.0f ns each), %u returned another length than on the device\n",
+           replayed, dt * 1e3, replayed ? dt * 1e9 / replayed : 0, differ);
+    free(data);
+    return 0;
+}
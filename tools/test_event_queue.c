@@ -0,0 +1,130 @@
+/* test_event_queue.c - Two thread stress test of the event queue (src/event_queue.c)
+ *
+ * A producer thread stands in for the TinyUSB task, the main thread for loop(). Every event carries its
+ * sequence number and a checksum of it, so the consumer sees any event lost, reordered, duplicated or
+ * torn (read while being written). Run once with the producer retrying on a full queue (nothing may be
+ * lost) and once with it dropping like the USB callbacks do (only counted drops may be missing).
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "event_queue.h"
+
+static struct event_queue queue;
+static uint32_t events;
+static int retry;
+static uint32_t producer_dropped;
+static int producer_done;
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t checksum(uint32_t seq) {
+    return seq * 2654435761u ^ 0x5A5A5A5Au;
+}
+
+static void *producer(void *arg) {
+    (void)arg;
+    for (uint32_t seq = 0; seq < events; seq++) {
+        const struct storage_event ev = { seq, (uint16_t)(seq % STORAGE_EV_TYPES), (uint16_t)(seq >> 16), checksum(seq) };
+        while (!event_queue_push(&queue, &ev)) {
+            sched_yield();  // let the consumer run, even on a single core
+            if (!retry) {
+                producer_dropped++;
+                break;
+            }
+        }
+    }
+    __atomic_store_n(&producer_done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void run(uint32_t n, int retry_full) {
+    memset(&queue, 0, sizeof(queue));
+    events = n;
+    retry = retry_full;
+    producer_dropped = 0;
+    producer_done = 0;
+
+    pthread_t thread;
+    const double t0 = now_s();
+    pthread_create(&thread, NULL, producer, NULL);
+
+    // Consume until the producer is done and the queue is empty
+    uint32_t received = 0, bad = 0, next = 0;
+    struct storage_event ev;
+    for (;;) {
+        // Done flag first: the producer may still push between an empty pop and reading it
+        const int done = __atomic_load_n(&producer_done, __ATOMIC_ACQUIRE);
+        if (!event_queue_pop(&queue, &ev)) {
+            if (done) {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        // In order, none twice, all fields of the same event
+        if ((ev.t_ms < next) || (ev.arg != checksum(ev.t_ms)) || (ev.type != ev.t_ms % STORAGE_EV_TYPES)
+         || (ev.slot != (uint16_t)(ev.t_ms >> 16))) {
+            bad++;
+        }
+        next = ev.t_ms + 1;
+        received++;
+    }
+    const double dt = now_s() - t0;
+    pthread_join(thread, NULL);
+
+    printf("%-17s %9u events, %9u received, %9u full, %u bad, %5.1f M events/s\n",
+           retry_full ? "retry when full:" : "drop when full:", n, received, event_queue_dropped(&queue),
+           bad, received / dt / 1e6);
+    CHECK(bad == 0);
+    if (retry_full) {
+        CHECK(received == n);   // the queue counts every push that found it full, even if retried
+    } else {
+        CHECK(event_queue_dropped(&queue) == producer_dropped);
+        CHECK(received + producer_dropped == n);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const uint32_t n = (argc > 1) ? (uint32_t)atoi(argv[1]) : 2000000;
+
+    // Single thread basics: empty, full, order
+    struct storage_event ev = { 0, STORAGE_EV_SLOT_OPENED, 1, 0 };
+    CHECK(!event_queue_pop(&queue, &ev));
+    for (uint32_t i = 0; i < EVENT_QUEUE_SIZE; i++) {
+        ev.t_ms = i;
+        CHECK(event_queue_push(&queue, &ev));
+    }
+    CHECK(!event_queue_push(&queue, &ev));
+    CHECK(event_queue_dropped(&queue) == 1);
+    CHECK(event_queue_pop(&queue, &ev) && (ev.t_ms == 0));
+    CHECK(event_queue_push(&queue, &ev));
+
+    printf("Event queue of %u events, 2 threads\n", EVENT_QUEUE_SIZE);
+    run(n, 1);
+    run(n, 0);
+
+    if (failures) {
+        fprintf(stderr, "test_event_queue: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("test_event_queue: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+/* test_fetch_sched.c - Host simulation of the fetch scheduler (src/fetch_sched.c)
+ *
+ * A frame opens one image after the other at its slide interval, with some jitter, and a download
+ * for the slot ahead takes a varying time. For frames from 5 s to 10 min per slide the simulation
+ * compares the scheduler against starting every download FETCH_SCHED_DELAY_MS after an open
+ * (what it does until it has learned the interval): how often the image is there in time, and how
+ * old it is when the frame opens it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "fetch_sched.h"
+
+#define OPENS 400
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+static uint32_t rnd_state = 1;
+
+// Uniform in [-range, range]
+static int32_t jitter(uint32_t range) {
+    rnd_state = rnd_state * 1103515245u + 12345u;
+    return range ? (int32_t)((rnd_state >> 8) % (2 * range + 1)) - (int32_t)range : 0;
+}
+
+struct result {
+    uint32_t hits;          // image complete before the frame opened its slot
+    double age_s;           // average age of the image when opened
+};
+
+// One prefetch slot ahead: after each open the download for the next image is scheduled
+static struct result simulate(uint32_t interval, uint32_t interval_jitter, uint32_t download, uint32_t download_jitter,
+                              int adaptive) {
+    struct result r = {0, 0};
+    fetch_sched_reset();
+    rnd_state = 1;
+    uint32_t now = 20000;
+    for (int i = 0; i < OPENS; i++) {
+        fetch_sched_opened(now);
+        uint32_t start = now + FETCH_SCHED_DELAY_MS;
+        if (adaptive) {
+            // The firmware loop asks again and again; the answer only changes with time
+            start = now + fetch_sched_wait(now, 1);
+        }
+        const uint32_t took = download + jitter(download_jitter);
+        fetch_sched_downloaded(took);
+        const uint32_t next = now + interval + jitter(interval_jitter);
+        const uint32_t done = start + took;
+        if ((int32_t)(next - done) >= 0) {
+            r.hits++;
+            r.age_s += (next - done) * 1e-3;
+        }
+        now = next;
+    }
+    r.age_s = r.hits ? r.age_s / r.hits : 0;
+    return r;
+}
+
+int main(void) {
+    static const struct {
+        uint32_t interval, interval_jitter, download, download_jitter;
+    } FRAMES[] = {
+        {   5000,   200,  800,  300 },
+        {  10000,   500, 1500,  500 },
+        {  60000,  2000, 1500, 1000 },
+        { 600000, 10000, 3000, 2000 },
+    };
+
+    printf("%u opens per frame, one slot prefetched\n\n", OPENS);
+    printf("%9s %9s  %-16s %-16s  %s\n", "interval", "download", "fixed delay", "scheduled", "prediction error");
+    printf("%9s %9s  %7s %8s %7s %8s\n", "", "", "in time", "age", "in time", "age");
+    for (size_t f = 0; f < sizeof(FRAMES) / sizeof(FRAMES[0]); f++) {
+        const struct result fixed = simulate(FRAMES[f].interval, FRAMES[f].interval_jitter,
+                                             FRAMES[f].download, FRAMES[f].download_jitter, 0);
+        const struct result sched = simulate(FRAMES[f].interval, FRAMES[f].interval_jitter,
+                                             FRAMES[f].download, FRAMES[f].download_jitter, 1);
+        struct fetch_sched_stats st;
+        fetch_sched_stats(&st);
+        printf("%7.0f s %7.1f s  %5.1f%% %7.1f s %5.1f%% %7.1f s  mean %u ms, interval learned %u +-%u ms\n",
+               FRAMES[f].interval / 1e3, FRAMES[f].download / 1e3,
+               100.0 * fixed.hits / OPENS, fixed.age_s, 100.0 * sched.hits / OPENS, sched.age_s,
+               st.mean_abs_error_ms, st.interval_ms, st.interval_dev_ms);
+
+        // Nearly always in time, and fresher than downloading right away
+        CHECK(sched.hits >= OPENS * 98 / 100);
+        CHECK(sched.age_s < fixed.age_s);
+        CHECK(st.predictions == OPENS - 2);
+        CHECK(st.mean_abs_error_ms <= FRAMES[f].interval_jitter);
+        CHECK(abs((int)st.interval_ms - (int)FRAMES[f].interval) <= (int)FRAMES[f].interval_jitter);
+    }
+
+    // Until an interval is known: FETCH_SCHED_DELAY_MS after the open; browsing doesn't teach it anything
+    fetch_sched_reset();
+    fetch_sched_opened(1000);
+    CHECK(fetch_sched_wait(1000, 1) == FETCH_SCHED_DELAY_MS);
+    fetch_sched_opened(1200);
+    fetch_sched_downloaded(1000);
+    CHECK(fetch_sched_wait(1300, 1) == FETCH_SCHED_DELAY_MS - 100);
+    CHECK(fetch_sched_wait(5000, 1) == 0);
+
+    // A re-read between slides is no interval sample and no prediction, and the next slide still
+    // counts from the one before: the deviation doesn't grow, the lead time stays
+    fetch_sched_reset();
+    for (uint32_t t = 0; t <= 50000; t += 10000) {
+        fetch_sched_opened(t);
+    }
+    struct fetch_sched_stats before, after;
+    fetch_sched_stats(&before);
+    fetch_sched_opened(50300);
+    fetch_sched_opened(60000);
+    fetch_sched_stats(&after);
+    CHECK(after.predictions == before.predictions + 1);
+    CHECK(after.last_error_ms == 0);
+    CHECK(after.interval_ms == 10000);
+    CHECK(after.interval_dev_ms < before.interval_dev_ms);
+
+    if (failures) {
+        fprintf(stderr, "test_fetch_sched: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("\ntest_fetch_sched: all checks passed\n");
+    return 0;
+}
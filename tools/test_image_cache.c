@@ -0,0 +1,191 @@
+/* test_image_cache.c - Host test of the flash image cache (src/image_cache.c) over an emulated flash file */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "image_cache.h"
+#include "flash_file.h"
+
+#define FLASH_SIZE (256 * 1024)     // 64 sectors
+#define MAX_IMAGE  (48 * 1024)
+
+static const char *path = "test_image_cache.bin";
+static struct flash_file ff;
+static struct cache_flash flash;
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+// Pseudo JPEG, content depends on id
+static uint32_t make_image(uint32_t id, uint8_t *buf) {
+    const uint32_t len = 8 * 1024 + (id * 7919) % (MAX_IMAGE - 8 * 1024);
+    uint32_t x = id * 2654435761u + 1;
+    for (uint32_t i = 0; i < len; i++) {
+        x = x * 1103515245u + 12345u;
+        buf[i] = (uint8_t)(x >> 16);
+    }
+    buf[0] = 0xFF; buf[1] = 0xD8;
+    buf[len - 2] = 0xFF; buf[len - 1] = 0xD9;
+    return len;
+}
+
+static int cached(uint32_t id) {
+    static uint8_t img[MAX_IMAGE], out[MAX_IMAGE];
+    const uint32_t len = make_image(id, img);
+    return (image_cache_read(image_cache_hash(img, len), out, sizeof(out)) == len) && (memcmp(img, out, len) == 0);
+}
+
+static void put(uint32_t id) {
+    static uint8_t img[MAX_IMAGE];
+    CHECK(image_cache_put(img, make_image(id, img)) == 0);
+}
+
+static void remount(void) {
+    flash_file_close(&ff);
+    CHECK(flash_file_open(&ff, &flash, path, FLASH_SIZE) == 0);
+    CHECK(image_cache_mount(&flash) >= 0);
+}
+
+int main(void) {
+    struct image_cache_stats st;
+    uint64_t hashes[IMAGE_CACHE_MAX_ENTRIES];
+
+    unlink(path);
+    CHECK(flash_file_open(&ff, &flash, path, FLASH_SIZE) == 0);
+    CHECK(image_cache_mount(&flash) == 0);
+
+    // Store and read back, newest first
+    for (uint32_t id = 1; id <= 4; id++) {
+        put(id);
+    }
+    for (uint32_t id = 1; id <= 4; id++) {
+        CHECK(cached(id));
+    }
+    image_cache_stats(&st);
+    CHECK(st.entries == 4 && st.puts == 4);
+
+    // Identical image is not written again
+    const uint32_t erases = st.erases;
+    put(3);
+    image_cache_stats(&st);
+    CHECK(st.entries == 4 && st.dedups == 1 && st.erases == erases);
+    CHECK(image_cache_list(hashes, 1) == 1);
+    {
+        uint8_t img[MAX_IMAGE];
+        CHECK(hashes[0] == image_cache_hash(img, make_image(3, img)));
+    }
+
+    // Survives a reboot
+    remount();
+    for (uint32_t id = 1; id <= 4; id++) {
+        CHECK(cached(id));
+    }
+
+    // Fill way beyond capacity, the oldest images go, the recent ones stay
+    for (uint32_t id = 5; id <= 200; id++) {
+        put(id);
+    }
+    CHECK(cached(200) && cached(199) && cached(198));
+    CHECK(!cached(5) && !cached(1));
+    image_cache_stats(&st);
+    CHECK(st.evictions > 0 && st.bytes <= FLASH_SIZE);
+
+    // Wear: no sector is erased much more often than the average
+    uint32_t lo = UINT32_MAX, hi = 0, sum = 0;
+    for (uint32_t s = 0; s < FLASH_SIZE / IMAGE_CACHE_SECTOR; s++) {
+        lo = (ff.erase_count[s] < lo) ? ff.erase_count[s] : lo;
+        hi = (ff.erase_count[s] > hi) ? ff.erase_count[s] : hi;
+        sum += ff.erase_count[s];
+    }
+    const uint32_t avg = sum / (FLASH_SIZE / IMAGE_CACHE_SECTOR);
+    printf("Erases per sector while filling: %u..%u, average %u\n", lo, hi, avg);
+    CHECK(hi <= avg + avg / 4 + 1);
+
+    // LRU: an image kept in use outlives the ones written after it
+    put(1000);
+    for (uint32_t id = 201; id <= 260; id++) {
+        put(id);
+        CHECK(cached(1000));
+    }
+    CHECK(!cached(201));
+    remount();
+    CHECK(cached(1000) && cached(260));
+
+    // Power cut half way through a write: no torn record, the rest of the cache is intact
+    image_cache_stats(&st);
+    const uint32_t entries = st.entries;
+    ff.fail_after = 10000;
+    CHECK(image_cache_put((uint8_t[MAX_IMAGE]){0}, MAX_IMAGE) != 0);
+    ff.fail_after = -1;
+    remount();
+    {
+        static uint8_t zero[MAX_IMAGE], out[MAX_IMAGE];
+        CHECK(image_cache_read(image_cache_hash(zero, MAX_IMAGE), out, sizeof(out)) == 0);
+    }
+    image_cache_stats(&st);
+    CHECK(st.entries > 0 && st.entries <= entries);
+    CHECK(cached(1000) && cached(260));
+    put(261);
+    CHECK(cached(261));
+
+    // Mapped: the same bytes straight from the mapping, pinned images survive the log wrapping around
+    {
+        static uint8_t img[MAX_IMAGE];
+        const void *data = NULL;
+        const uint32_t len = make_image(261, img);
+        const uint64_t hash = image_cache_hash(img, len);
+        CHECK(flash.map != NULL);
+        CHECK(image_cache_map(hash, &data) == len && memcmp(data, img, len) == 0);
+        image_cache_pin(hash, true);
+        for (uint32_t id = 300; id <= 340; id++) {
+            put(id);
+        }
+        CHECK(memcmp(data, img, len) == 0);
+        CHECK(image_cache_map(hash, &data) == len && memcmp(data, img, len) == 0);
+        image_cache_pin(hash, false);
+        for (uint32_t id = 341; id <= 380; id++) {
+            put(id);
+        }
+        CHECK(image_cache_map(hash, &data) == 0);
+    }
+
+    // Streamed put of an image bigger than any RAM buffer, in pieces
+    {
+        static uint8_t big[3 * MAX_IMAGE];
+        for (uint32_t i = 0; i < sizeof(big); i++) {
+            big[i] = (uint8_t)(i * 131 + (i >> 9));
+        }
+        uint64_t hash = 0;
+        const void *data = NULL;
+        CHECK(image_cache_begin(sizeof(big)) == 0);
+        for (uint32_t off = 0; off < sizeof(big); off += 1000) {
+            const uint32_t n = (sizeof(big) - off < 1000) ? sizeof(big) - off : 1000;
+            CHECK(image_cache_write(big + off, n) == 0);
+        }
+        CHECK(memcmp(image_cache_pending(), big, sizeof(big)) == 0);
+        CHECK(image_cache_commit(&hash) == 0 && hash == image_cache_hash(big, sizeof(big)));
+        CHECK(image_cache_map(hash, &data) == sizeof(big) && memcmp(data, big, sizeof(big)) == 0);
+
+        // Cut short: nothing is stored
+        CHECK(image_cache_begin(1000) == 0);
+        CHECK(image_cache_write(big, 500) == 0);
+        CHECK(image_cache_commit(&hash) != 0);
+        remount();
+        CHECK(image_cache_map(image_cache_hash(big, sizeof(big)), &data) == sizeof(big));
+        CHECK(image_cache_map(image_cache_hash(big, 500), &data) == 0);
+    }
+
+    flash_file_close(&ff);
+    unlink(path);
+
+    if (failures) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("image cache: all checks passed\n");
+    return 0;
+}
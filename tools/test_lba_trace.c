@@ -0,0 +1,102 @@
+/* test_lba_trace.c - Host test of the LBA access trace (src/lba_trace.c)
+ *
+ * Records a host mounting the volume and reading an image, more than the ring holds, checks what is kept
+ * and exports it the way "get trace hex" does, wrapped in serial console noise, for replay_trace to read.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "lba_trace.h"
+#include "storage.h"
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+static uint32_t t_us;
+
+static void read_lba(uint32_t lba, uint32_t bufsize) {
+    lba_trace_record(t_us, LBA_TRACE_READ, lba, 0, bufsize, bufsize);
+    t_us += 150 + bufsize / 8;
+}
+
+// What a host does on mount: MBR, VBR, FAT, root directory
+static void mount(void) {
+    read_lba(0, 512);
+    read_lba(2048, 512);
+    read_lba(2052, 4096);
+    read_lba(2116, 4096);
+}
+
+// Open an image and read it 4 KB at a time
+static void read_image(uint32_t image, uint32_t len) {
+    const struct lba_extent *ext = volume_image_extent(image);
+    for (uint32_t s = 0; s * DISK_SECTOR_SIZE < len; s += 8) {
+        read_lba(ext->lba + s, 4096);
+    }
+}
+
+static void emit(const char *line, void *ctx) {
+    fprintf((FILE *)ctx, "%s\r\n", line);
+}
+
+int main(int argc, char *argv[]) {
+    struct lba_trace_entry e;
+
+    CHECK(lba_trace_end() == 0);
+    CHECK(!lba_trace_get(0, &e));
+
+    mount();
+    CHECK(lba_trace_end() == 4);
+    CHECK(lba_trace_get(1, &e) && (e.lba == 2048) && (e.bufsize == 512) && (e.op == LBA_TRACE_READ));
+    CHECK(!lba_trace_get(4, &e));
+
+    // Cleared entries are gone, new ones are kept
+    lba_trace_clear();
+    CHECK(!lba_trace_get(3, &e));
+    read_lba(2116, 512);
+    CHECK(lba_trace_get(4, &e) && (e.lba == 2116));
+
+    // Not recorded while off
+    lba_trace_enable(false);
+    read_lba(1, 512);
+    CHECK(lba_trace_end() == 5);
+    lba_trace_enable(true);
+
+    // Wrap around: only the latest LBA_TRACE_ENTRIES - 1 remain, the next record goes to the oldest slot
+    t_us = 1000000;
+    for (uint32_t round = 0; lba_trace_end() < 2 * LBA_TRACE_ENTRIES; round++) {
+        t_us += 10000000;
+        mount();
+        read_image(round % VOLUME_IMAGES, 40000 + round * 1000);
+    }
+    const uint32_t end = lba_trace_end();
+    CHECK(!lba_trace_get(end - LBA_TRACE_ENTRIES, &e));
+    CHECK(lba_trace_get(end - LBA_TRACE_ENTRIES + 1, &e));
+    CHECK(lba_trace_get(end - 1, &e) && (e.bufsize == 4096));
+
+    // Export, between lines a serial console shows anyway
+    if (argc > 1) {
+        FILE *f = fopen(argv[1], "w");
+        if (f == NULL) {
+            perror(argv[1]);
+            return 1;
+        }
+        fprintf(f, "get trace hex\r\n");
+        CHECK(lba_trace_export(emit, f) == LBA_TRACE_ENTRIES - 1);
+        fprintf(f, "USB: frame profile none\r\n");
+        fclose(f);
+        CHECK(lba_trace_enabled());
+    }
+
+    if (failures) {
+        fprintf(stderr, "test_lba_trace: %d checks failed\n", failures);
+        return 1;
+    }
+    printf("test_lba_trace: all checks passed (%u entries kept of %u)\n", LBA_TRACE_ENTRIES - 1, end);
+    return 0;
+}
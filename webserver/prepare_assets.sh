@@ -1,22 +1,65 @@
 #!/usr/bin/env bash
-# Resize and convert all images in assets/ to 800x600 JPEG, quality 65.
+# Resize and convert all images in assets/ to 800x600 JPEG, on all cores.
 # Images are cropped (center) if the aspect ratio does not match.
 # Output overwrites the original file (always saved as .jpg).
+#
+# Quality is 65 unless one of these picks it per image, by binary search:
+#   --max-bytes N   highest quality whose file has at most N bytes
+#   --ssim X        lowest quality whose SSIM against the resized image is at least X
+# Either way no file gets over MAX_BYTES (the device's 128 KB slot): the quality is lowered
+# until it fits, an image that doesn't even fit at MIN_QUALITY is left alone and reported.
+#
+# assets/manifest.tsv lists every image with its size, quality and SHA-256. Images whose hash
+# is in it are done and skipped on the next run (--force does them again).
+#
+# Usage: prepare_assets.sh [--max-bytes N | --ssim X] [--size WxH] [--jobs N] [--force]
 
 set -euo pipefail
 
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 ASSETS_DIR="$SCRIPT_DIR/assets"
+MANIFEST="$ASSETS_DIR/manifest.tsv"
 TARGET_W=800
 TARGET_H=600
 QUALITY=65
+MIN_QUALITY=20
+MAX_QUALITY=95
 MAX_BYTES=$((128 * 1024))
+BUDGET=""
+SSIM=""
+JOBS=$(nproc 2>/dev/null || echo 1)
+FORCE=0
 
-if ! command -v convert &>/dev/null; then
-    echo "ERROR: ImageMagick 'convert' not found. Install with: sudo apt install imagemagick"
+usage() {
+    sed -n 's/^# \(Usage: \)/\1/p' "${BASH_SOURCE[0]}"
+    exit 1
+}
+
+while [[ $# -gt 0 ]]; do
+    case "$1" in
+        --max-bytes) BUDGET="$2"; shift 2 ;;
+        --ssim)      SSIM="$2"; shift 2 ;;
+        --size)      TARGET_W="${2%x*}"; TARGET_H="${2#*x}"; shift 2 ;;
+        --jobs)      JOBS="$2"; shift 2 ;;
+        --force)     FORCE=1; shift ;;
+        *)           usage ;;
+    esac
+done
+if [[ -n "$BUDGET" && -n "$SSIM" ]]; then
+    usage
+fi
+if [[ -n "$BUDGET" && "$BUDGET" -gt "$MAX_BYTES" ]]; then
+    echo "ERROR: --max-bytes $BUDGET is above the device limit of $MAX_BYTES bytes"
     exit 1
 fi
 
+for tool in convert compare; do
+    if ! command -v "$tool" &>/dev/null; then
+        echo "ERROR: ImageMagick '$tool' not found. Install with: sudo apt install imagemagick"
+        exit 1
+    fi
+done
+
 shopt -s nullglob nocaseglob
 files=("$ASSETS_DIR"/*.{jpg,jpeg,png,gif,bmp,webp,tiff,tif})
 shopt -u nullglob nocaseglob
@@ -26,43 +69,154 @@ if [[ ${#files[@]} -eq 0 ]]; then
     exit 0
 fi
 
-echo "Processing ${#files[@]} file(s) in $ASSETS_DIR"
+# Hashes of the images done before: their manifest lines are kept, the images skipped
+declare -A done_hashes=()
+if [[ $FORCE -eq 0 && -f "$MANIFEST" ]]; then
+    while IFS=$'\t' read -r name w h q bytes sha; do
+        [[ "$name" == "file" ]] || done_hashes[$sha]=1
+    done < "$MANIFEST"
+fi
+
+todo=("${files[@]}")
+if [[ ${#done_hashes[@]} -gt 0 ]]; then
+    todo=()
+    while read -r sha src; do
+        [[ -n "${done_hashes[$sha]:-}" ]] || todo+=("$src")
+    done < <(printf '%s\0' "${files[@]}" | xargs -0 sha256sum)
+fi
+
+mode="quality $QUALITY"
+[[ -n "$BUDGET" ]] && mode="at most $BUDGET bytes"
+[[ -n "$SSIM" ]] && mode="SSIM at least $SSIM"
+echo "Processing ${#todo[@]} of ${#files[@]} file(s) in $ASSETS_DIR, ${TARGET_W}x${TARGET_H}, $mode, $JOBS jobs"
 echo
 
-for src in "${files[@]}"; do
+# One image: resize once, then encode at the qualities the search asks for. Prints its manifest line
+process() {
+    local src="$1"
+    local filename name dst tmp size_before size="" ssim="" encoded=""
     filename="$(basename "$src")"
     name="${filename%.*}"
     dst="$ASSETS_DIR/${name}.jpg"
-
+    tmp="$(mktemp -d)"
+    trap "rm -rf '$tmp'" EXIT
     size_before=$(wc -c < "$src")
 
-    # Resize to fill 800x600 (^ = cover), center-crop to exact size, strip metadata
+    # Resize to fill the frame (^ = cover), center-crop to exact size, strip metadata
     convert "$src" \
         -resize "${TARGET_W}x${TARGET_H}^" \
         -gravity Center \
         -extent "${TARGET_W}x${TARGET_H}" \
-        -quality "$QUALITY" \
         -strip \
-        "$dst"
+        "$tmp/ref.ppm"
 
+    # Baseline 4:2:0, what every frame decodes. Sets size (and ssim) of quality $1 in $tmp/q$1.jpg.
+    # Runs inside the search's if, where set -e doesn't apply: a failed convert ends this image here
+    encode() {
+        if ! convert "$tmp/ref.ppm" -quality "$1" -sampling-factor 4:2:0 -interlace None "$tmp/q$1.jpg" \
+                || [[ ! -s "$tmp/q$1.jpg" ]]; then
+            printf "  %-30s  ERROR: convert failed at quality %d, left as it is\n" "$filename" "$1" >&2
+            exit 1
+        fi
+        encoded=$1
+        size=$(wc -c < "$tmp/q$1.jpg")
+        if [[ -n "$SSIM" ]]; then
+            ssim=$(compare -metric SSIM "$tmp/ref.ppm" "$tmp/q$1.jpg" null: 2>&1 || true)
+            ssim="${ssim%% *}"
+        fi
+    }
+    # Quality $1 is good enough: fits the budget, or looks close enough to the resized image
+    good() {
+        encode "$1"
+        if [[ -n "$SSIM" ]]; then
+            awk -v s="$ssim" -v t="$SSIM" 'BEGIN { exit !(s + 0 >= t + 0) }'
+        else
+            [[ $size -le ${BUDGET:-$MAX_BYTES} ]]
+        fi
+    }
+
+    local q lo hi
+    if [[ -n "$BUDGET" ]]; then
+        # Highest quality within the budget: size grows with quality
+        lo=$MIN_QUALITY; hi=$MAX_QUALITY
+        while [[ $lo -lt $hi ]]; do
+            q=$(( (lo + hi + 1) / 2 ))
+            if good "$q"; then lo=$q; else hi=$((q - 1)); fi
+        done
+        q=$lo
+    elif [[ -n "$SSIM" ]]; then
+        # Lowest quality that looks close enough: SSIM grows with quality
+        lo=$MIN_QUALITY; hi=$MAX_QUALITY
+        while [[ $lo -lt $hi ]]; do
+            q=$(( (lo + hi) / 2 ))
+            if good "$q"; then hi=$q; else lo=$((q + 1)); fi
+        done
+        q=$lo
+    else
+        q=$QUALITY
+    fi
+    [[ "$encoded" == "$q" ]] || encode "$q"
+
+    # Never over the device limit: lower the quality until it fits
+    while [[ $size -gt $MAX_BYTES && $q -gt $MIN_QUALITY ]]; do
+        q=$(( q - 5 > MIN_QUALITY ? q - 5 : MIN_QUALITY ))
+        encode "$q"
+    done
+    if [[ $size -gt $MAX_BYTES ]]; then
+        printf "  %-30s  %6d KB  ->  %6d KB  ERROR: over %d bytes even at quality %d, left as it is\n" \
+            "$filename" $(( size_before / 1024 )) $(( size / 1024 )) "$MAX_BYTES" "$q" >&2
+        return 1
+    fi
+
+    mv "$tmp/q$q.jpg" "$dst.tmp"
+    mv "$dst.tmp" "$dst"
     # Remove original if it was a different format
     if [[ "$src" != "$dst" ]]; then
         rm "$src"
     fi
 
-    size_after=$(wc -c < "$dst")
+    printf "  %-30s  %6d KB  ->  %6d KB  q%d%s\n" \
+        "$filename" $(( size_before / 1024 )) $(( size / 1024 )) "$q" \
+        "${ssim:+  SSIM $ssim}" >&2
+    printf "%s\t%d\t%d\t%d\t%d\t%s\n" \
+        "${name}.jpg" "$TARGET_W" "$TARGET_H" "$q" "$size" "$(sha256sum < "$dst" | cut -d' ' -f1)"
+}
 
-    status="OK"
-    if [[ $size_after -gt $MAX_BYTES ]]; then
-        status="WARNING: ${size_after} bytes exceeds 128 KB"
-    fi
+export -f process
+export ASSETS_DIR TARGET_W TARGET_H QUALITY MIN_QUALITY MAX_QUALITY MAX_BYTES BUDGET SSIM
+# One image per convert process: the jobs keep the cores busy
+export MAGICK_THREAD_LIMIT=1
 
-    printf "  %-30s  %6d KB  ->  %6d KB  %s\n" \
-        "$filename" \
-        $(( size_before / 1024 )) \
-        $(( size_after  / 1024 )) \
-        "$status"
-done
+results="$(mktemp)"
+status=0
+if [[ ${#todo[@]} -gt 0 ]]; then
+    printf '%s\0' "${todo[@]}" | xargs -0 -n 1 -P "$JOBS" bash -c 'set -euo pipefail; process "$1"' _ > "$results" || status=1
+fi
+
+# Manifest: what was there for images still present and untouched, plus what was done now
+declare -A redone=()
+while IFS=$'\t' read -r name rest; do
+    redone[$name]=1
+done < "$results"
+{
+    printf "file\twidth\theight\tquality\tbytes\tsha256\n"
+    {
+        if [[ -f "$MANIFEST" ]]; then
+            while IFS=$'\t' read -r name w h q bytes sha; do
+                if [[ "$name" != "file" && -f "$ASSETS_DIR/$name" && -z "${redone[$name]:-}" ]]; then
+                    printf "%s\t%s\t%s\t%s\t%s\t%s\n" "$name" "$w" "$h" "$q" "$bytes" "$sha"
+                fi
+            done < "$MANIFEST"
+        fi
+        cat "$results"
+    } | sort
+} > "$MANIFEST.tmp"
+mv "$MANIFEST.tmp" "$MANIFEST"
+rm -f "$results"
 
 echo
-echo "Done."
+if [[ $status -ne 0 ]]; then
+    echo "Done, with errors. Manifest: $MANIFEST"
+    exit 1
+fi
+echo "Done. Manifest: $MANIFEST"
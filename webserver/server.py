@@ -4,12 +4,44 @@ Image webserver for the wifidrv picture frame.
 
 Serves images from the assets/ subfolder in round-robin order.
 Each GET request — regardless of path — returns the next image.
+
+Speaks HTTP/1.1 with keep-alive: a client may send any number of requests over one
+connection. --keepalive-timeout and --max-requests make the server close connections
+the way real servers do, to test that the client notices and reconnects.
+
+Every image carries a strong ETag (hash of its bytes) and Last-Modified. A request with
+If-None-Match or If-Modified-Since matching the image about to be served gets
+304 Not Modified; --hold keeps serving the same image for a while to try that.
+
+Range requests get 206 Partial Content. A Range request whose If-Range names one of the
+images continues that image, whichever one is up next, so a client can resume a broken
+off download. --drop-after cuts responses short to try that.
+
+--rate paces bodies to a WiFi-like speed, for tools/bench_fetch.
+
+The device sends the biggest image it takes (X-Max-Bytes) and its frame's resolution
+(X-Frame-Size: 800x600). It gets the smaller of the image and a variant made for it: scaled to
+the frame and encoded with ImageMagick at --quality, or lower until it fits X-Max-Bytes
+(variants.py). Variants are encoded by a pool of workers and cached in memory and on disk;
+one not there yet is queued, and the request gets the image as it is if that fits, or another
+image that does. Without ImageMagick only images that fit as they are go out. GET /variants
+shows the cache.
 """
 
 import argparse
+import email.utils
+import hashlib
+import itertools
 import os
 import random
-from http.server import BaseHTTPRequestHandler, HTTPServer
+import re
+import socket
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+from variants import LRU, SAMPLING, Profile, Variants, fits, jpeg_size, parse_frame, profile_name
 
 ASSETS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "assets")
 
@@ -23,6 +55,11 @@ CONTENT_TYPES = {
 
 _images = []
 _index  = 0
+_conn_ids = itertools.count(1)
+_sources = LRU(64 << 20)    # (path, mtime, size) -> (bytes, hash)
+_variants = Variants(1, 64 << 20)
+_held   = (None, 0.0)   # image served during --hold, until when
+_lock   = threading.Lock()
 
 
 def load_images():
@@ -53,30 +90,292 @@ def random_image():
     return name, path, ctype
 
 
-def serve_image(handler, name, path, ctype):
+def held_image(hold):
+    """Random image, the same one for hold seconds"""
+    global _held
+    with _lock:
+        image, until = _held
+        if image is None or time.monotonic() >= until:
+            _held = (random_image(), time.monotonic() + hold)
+        return _held[0]
+
+
+def source(path):
+    """Bytes of an image and their hash (equal hashes mean byte-identical images), read once and kept
+    in memory until the file changes or --cache-mb pushes it out"""
+    st  = os.stat(path)
+    key = (path, st.st_mtime_ns, st.st_size)
+    cached = _sources.get(key)
+    if cached:
+        return cached[0]
     with open(path, "rb") as f:
         data = f.read()
+    entry = (data, hashlib.sha256(data).hexdigest()[:32])
+    _sources.put(key, entry, len(data))
+    return entry
+
+
+def not_modified(headers, etag, mtime):
+    """Conditional request the image satisfies (RFC 9110 13.1.2/13.1.3): If-None-Match if sent,
+    If-Modified-Since otherwise"""
+    inm = headers.get("If-None-Match")
+    if inm is not None:
+        # Weak comparison, the W/ prefix doesn't matter here
+        tags = [t.strip() for t in inm.split(",")]
+        return "*" in tags or etag in (t[2:] if t.startswith("W/") else t for t in tags)
+    ims = headers.get("If-Modified-Since")
+    if ims:
+        try:
+            since = email.utils.parsedate_to_datetime(ims).timestamp()
+        except (TypeError, ValueError):
+            return False
+        return int(mtime) <= since
+    return False
+
+
+def validators(path):
+    """ETag and Last-Modified of an image"""
+    data, digest = source(path)
+    mtime = os.path.getmtime(path)
+    return data, mtime, f'"{digest}"', email.utils.formatdate(mtime, usegmt=True)
 
-    handler.send_response(200)
-    handler.send_header("Content-Type",   ctype)
-    handler.send_header("Content-Length", str(len(data)))
-    handler.end_headers()
-    handler.wfile.write(data)
 
-    print(f"  {handler.client_address[0]}  {handler.path}  ->  {name}  ({len(data):,} bytes)")
+def request_profile(headers):
+    """What the device asks for: (max bytes, frame, profile). The profile is None for a request without
+    X-Max-Bytes and X-Frame-Size, which gets the images as they are. Its quality, progressive and chroma
+    subsampling are the server's (--quality, --progressive, --sampling) unless the request sets them"""
+    max_bytes = headers.get("X-Max-Bytes", "").strip()
+    max_bytes = int(max_bytes) if max_bytes.isdigit() else None
+    frame = parse_frame(headers.get("X-Frame-Size"))
+    if max_bytes is None and frame is None:
+        return None, None, None
+    quality = headers.get("X-Jpeg-Quality", "").strip()
+    mode = headers.get("X-Jpeg-Mode", "").strip().lower()
+    sampling = headers.get("X-Jpeg-Sampling", "").strip()
+    profile = Profile(*(frame or (0, 0)),
+                      quality=max(1, min(int(quality), 100)) if quality.isdigit() else ImageHandler.quality,
+                      progressive=(mode == "progressive") if mode in ("baseline", "progressive") else ImageHandler.progressive,
+                      sampling=sampling if sampling in SAMPLING else ImageHandler.sampling)
+    return max_bytes, frame, profile
+
+
+def load(name, request, wait=None, queue=True):
+    """Image as served for a request_profile(): (name, type, bytes, mtime, ETag, Last-Modified, variant
+    label or ""). The smaller of the image and its variant for the profile, of those that fit. A variant
+    not encoded yet is queued and left out, unless wait gives the seconds to wait for it. None: nothing fits,
+    False: only the variant would, and it isn't encoded yet. Without queue only cached variants count"""
+    max_bytes, frame, profile = request
+    path = os.path.join(ASSETS_DIR, name)
+    ctype = CONTENT_TYPES[os.path.splitext(name)[1].lower()]
+    data, mtime, etag, modified = validators(path)
+    image = (name, ctype, data, mtime, etag, modified, "")
+    if profile is None:
+        return image
+    if not profile.width:
+        size = jpeg_size(data)
+        if size is None:
+            return image if fits(data, max_bytes, frame) else None
+        profile = profile._replace(width=size[0], height=size[1])
+    if queue:
+        v = _variants.get(etag.strip('"'), data, profile, max_bytes, frame, wait)
+    else:
+        v = _variants.best(etag.strip('"'), data, profile, max_bytes, frame, False)
+    if v and (len(v[0]) < len(data) or not fits(data, max_bytes, frame)):
+        return name, "image/jpeg", v[0], mtime, v[1], modified, profile_name(v[2])
+    if fits(data, max_bytes, frame):
+        return image
+    return False if v is False else None
+
+
+def fitting_image(name, request):
+    """name, or a variant of it, if either fits the device right now; else another image that does;
+    else name if its variant is encoded within encode_wait. None: nothing fits, False: still encoding"""
+    image = load(name, request)
+    others = random.sample(_images, len(_images))
+    while not image and others:
+        image = load(others.pop(), request)
+    if not image and _variants.available:
+        image = load(name, request, ImageHandler.encode_wait)
+    return image
+
+
+def image_by_validator(validator, request):
+    """Image an If-Range names, by ETag or Last-Modified, as served for the request. Only the sources
+    and the variants encoded already are compared: looking through the library queues no encodings"""
+    for name in _images:
+        image = load(name, request, queue=False)
+        if image and validator in (image[4], image[5]):
+            return image
+    return None
+
+
+def byte_range(headers, size, etag, modified):
+    """(first, last) the request asks for, None for the whole image: no Range, or If-Range names
+    another image (RFC 9110 13.1.5). "unsatisfiable" for a range beyond the end"""
+    m = re.fullmatch(r"bytes=(\d*)-(\d*)", headers.get("Range", "").strip())
+    if_range = headers.get("If-Range")
+    if not m or (if_range is not None and if_range not in (etag, modified)) or m.groups() == ("", ""):
+        return None
+    first, last = m.groups()
+    if first == "":
+        first, last = max(size - int(last), 0), size - 1   # suffix: the last n bytes
+    else:
+        first, last = int(first), min(int(last), size - 1) if last else size - 1
+    if first >= size or first > last:
+        return "unsatisfiable"
+    return first, last
+
+
+SEGMENT = 1460   # TCP payload per WiFi frame
+
+
+def write_paced(handler, data):
+    """data at --rate kB/s, a segment at a time"""
+    rate = handler.rate * 1024
+    if not rate:
+        handler.wfile.write(data)
+        return
+    t0 = time.monotonic()
+    for off in range(0, len(data), SEGMENT):
+        handler.wfile.write(data[off:off + SEGMENT])
+        ahead = t0 + (off + SEGMENT) / rate - time.monotonic()
+        if ahead > 0:
+            time.sleep(ahead)
+
+
+def send_body(handler, body):
+    """Body, or with --drop-after only its first bytes before the connection is cut"""
+    cut = handler.drop_after
+    if not cut or len(body) <= cut or random.random() >= handler.drop_prob:
+        write_paced(handler, body)
+        return ""
+    write_paced(handler, body[:cut])
+    handler.wfile.flush()
+    handler.close_connection = True
+    try:
+        handler.connection.shutdown(socket.SHUT_RDWR)
+    except OSError:
+        pass
+    return f"  [dropped after {cut:,} bytes]"
+
+
+def serve_image(handler, image):
+    name, ctype, data, mtime, etag, modified, label = image
+    rng = byte_range(handler.headers, len(data), etag, modified)
+
+    if not_modified(handler.headers, etag, mtime):
+        handler.send_response(304)
+        handler.send_header("ETag",          etag)
+        handler.send_header("Last-Modified", modified)
+        handler.send_header("Vary",          "X-Max-Bytes, X-Frame-Size")
+        handler.end_headers()
+        result = "not modified"
+    elif rng == "unsatisfiable":
+        handler.send_response(416)
+        handler.send_header("Content-Range",  f"bytes */{len(data)}")
+        handler.send_header("Content-Length", "0")
+        handler.end_headers()
+        result = "range not satisfiable"
+    elif rng:
+        first, last = rng
+        handler.send_response(206)
+        handler.send_header("Content-Type",   ctype)
+        handler.send_header("Content-Range",  f"bytes {first}-{last}/{len(data)}")
+        handler.send_header("Content-Length", str(last - first + 1))
+        handler.send_header("ETag",           etag)
+        handler.send_header("Last-Modified",  modified)
+        handler.send_header("Vary",           "X-Max-Bytes, X-Frame-Size")
+        handler.end_headers()
+        result = f"bytes {first:,}-{last:,} of {len(data):,}" + send_body(handler, data[first:last + 1])
+    else:
+        handler.send_response(200)
+        handler.send_header("Content-Type",   ctype)
+        handler.send_header("Content-Length", str(len(data)))
+        handler.send_header("Accept-Ranges",  "bytes")
+        handler.send_header("ETag",           etag)
+        handler.send_header("Last-Modified",  modified)
+        handler.send_header("Vary",           "X-Max-Bytes, X-Frame-Size")
+        handler.end_headers()
+        result = f"{len(data):,} bytes" + send_body(handler, data)
+
+    print(f"  {handler.client_address[0]}  conn {handler.conn_id} #{handler.requests}"
+          f"  {handler.path}  ->  {name}" + (f" [{label}]" if label else "") + f"  ({result})"
+          + ("  [closing]" if handler.close_connection else ""))
 
 
 class ImageHandler(BaseHTTPRequestHandler):
+    # Keep-alive; every response carries a Content-Length (send_error too)
+    protocol_version = "HTTP/1.1"
+    timeout          = 15       # seconds an idle connection stays open
+    max_requests     = 0        # requests per connection, 0: no limit
+    hold             = 0        # seconds /picture-frame keeps serving the same image
+    drop_after       = 0        # cut bodies after this many bytes, 0: never
+    drop_prob        = 1.0      # share of the bodies cut
+    rate             = 0        # kB/s bodies are sent at, 0: as fast as possible
+    quality          = 65       # variants: JPEG quality to start from, progressive, chroma subsampling
+    progressive      = False
+    sampling         = "4:2:0"
+    encode_wait      = 3        # seconds a request waits for a variant when nothing else fits, below the
+                                # device's 5 s HTTP timeout: after that it gets 503 and asks again
+
+    def setup(self):
+        super().setup()
+        self.conn_id  = next(_conn_ids)
+        self.requests = 0
+        print(f"  {self.client_address[0]}  conn {self.conn_id} opened")
+
+    def finish(self):
+        super().finish()
+        print(f"  {self.client_address[0]}  conn {self.conn_id} closed after {self.requests} requests")
+
+    def end_headers(self):
+        if self.max_requests and self.requests >= self.max_requests:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        super().end_headers()
 
     def do_GET(self):
+        self.requests += 1
         path = self.path.rstrip("/")
 
         if path == "/picture-frame":
-            name, fpath, ctype = random_image()
-            if name is None:
-                self.send_error(404, "No images in assets/")
+            request = request_profile(self.headers)
+            image = None
+            if "Range" in self.headers and "If-Range" in self.headers:
+                image = image_by_validator(self.headers["If-Range"], request)
+            if image is None:
+                name = (held_image(self.hold) if self.hold else random_image())[0]
+                if name is None:
+                    self.send_error(404, "No images in assets/")
+                    return
+                image = fitting_image(name, request)
+            if image is False:
+                # The encoding goes on in the pool, the next request finds it
+                print(f"  {self.client_address[0]}  conn {self.conn_id} #{self.requests}"
+                      f"  {self.path}  ->  variant still encoding, 503")
+                body = b"Variant still encoding, try again\n"
+                self.send_response(503)
+                self.send_header("Retry-After",    "2")
+                self.send_header("Content-Type",   "text/plain")
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
                 return
-            serve_image(self, name, fpath, ctype)
+            if image is None:
+                print(f"  {self.client_address[0]}  conn {self.conn_id} #{self.requests}"
+                      f"  {self.path}  ->  no image fits X-Max-Bytes {self.headers.get('X-Max-Bytes')}"
+                      f" X-Frame-Size {self.headers.get('X-Frame-Size')}")
+                self.send_error(406, "No image fits X-Max-Bytes / X-Frame-Size")
+                return
+            serve_image(self, image)
+
+        elif path == "/variants":
+            body = (_variants.status() + "\n").encode()
+            self.send_response(200)
+            self.send_header("Content-Type",   "text/plain")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
 
         else:
             self.send_error(404, "Not found")
@@ -85,6 +384,16 @@ class ImageHandler(BaseHTTPRequestHandler):
         pass  # suppress default apache-style access log
 
 
+class ImageServer(ThreadingHTTPServer):
+    """A thread per connection, a kept connection doesn't hold up other clients"""
+    daemon_threads = True
+
+    def handle_error(self, request, client_address):
+        # Clients dropping a kept connection are business as usual
+        if not isinstance(sys.exc_info()[1], (ConnectionResetError, BrokenPipeError)):
+            super().handle_error(request, client_address)
+
+
 def main():
     parser = argparse.ArgumentParser(
         description="Image webserver for wifidrv picture frame"
@@ -93,8 +402,55 @@ def main():
                         help="Bind address (default: 0.0.0.0)")
     parser.add_argument("--port", type=int, default=8080,
                         help="Port to listen on (default: 8080)")
+    parser.add_argument("--keepalive-timeout", type=float, default=ImageHandler.timeout,
+                        help="Close connections idle this many seconds "
+                             f"(default: {ImageHandler.timeout})")
+    parser.add_argument("--max-requests", type=int, default=0,
+                        help="Close a connection after this many requests (default: no limit)")
+    parser.add_argument("--http10", action="store_true",
+                        help="HTTP/1.0, one request per connection")
+    parser.add_argument("--hold", type=float, default=0,
+                        help="Serve the same image for this many seconds (default: a new one per request)")
+    parser.add_argument("--drop-after", type=int, default=0,
+                        help="Cut the connection after this many bytes of a body (default: never)")
+    parser.add_argument("--drop-prob", type=float, default=1.0,
+                        help="Share of the bodies longer than --drop-after that are cut (default: 1)")
+    parser.add_argument("--rate", type=float, default=0,
+                        help="Send bodies at this many kB/s, like WiFi (default: as fast as possible)")
+    parser.add_argument("--quality", type=int, default=ImageHandler.quality,
+                        help=f"JPEG quality of variants, lowered until they fit X-Max-Bytes (default: {ImageHandler.quality})")
+    parser.add_argument("--progressive", action="store_true",
+                        help="Progressive variants (default: baseline, which every frame decodes)")
+    parser.add_argument("--sampling", choices=SAMPLING, default=ImageHandler.sampling,
+                        help=f"Chroma subsampling of variants (default: {ImageHandler.sampling})")
+    parser.add_argument("--workers", type=int, default=os.cpu_count() or 1,
+                        help="Variants encoded at once (default: one per core)")
+    parser.add_argument("--cache-mb", type=int, default=64,
+                        help="Memory for images and variants, each (default: 64)")
+    parser.add_argument("--cache-dir", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".variants"),
+                        help="Where variants are kept across restarts, '' for nowhere (default: webserver/.variants)")
+    parser.add_argument("--disk-cache-mb", type=int, default=512,
+                        help="Disk space for variants (default: 512)")
+    parser.add_argument("--warm", default="",
+                        help="Encode variants of every image for these frames at startup, e.g. 800x600,1024x768")
     args = parser.parse_args()
 
+    ImageHandler.timeout      = args.keepalive_timeout
+    ImageHandler.max_requests = args.max_requests
+    ImageHandler.hold         = args.hold
+    ImageHandler.drop_after   = args.drop_after
+    ImageHandler.drop_prob    = args.drop_prob
+    ImageHandler.rate         = args.rate
+    ImageHandler.quality      = args.quality
+    ImageHandler.progressive  = args.progressive
+    ImageHandler.sampling     = args.sampling
+    if args.http10:
+        ImageHandler.protocol_version = "HTTP/1.0"
+
+    global _sources, _variants
+    _sources  = LRU(args.cache_mb << 20)
+    _variants = Variants(args.workers, args.cache_mb << 20, args.cache_dir, args.disk_cache_mb << 20)
+
     load_images()
 
     if not _images:
@@ -105,9 +461,18 @@ def main():
             size = os.path.getsize(os.path.join(ASSETS_DIR, name))
             print(f"  {name}  ({size:,} bytes)")
 
+    if not _variants.available:
+        print("Variants: none, ImageMagick 'convert' not found. Devices get the images that fit as they are")
+    else:
+        print(f"Variants: {args.quality} quality, {'progressive' if args.progressive else 'baseline'}, "
+              f"{args.sampling}, {args.workers} workers; {_variants.status()}")
+        for frame in filter(None, (parse_frame(f) for f in args.warm.split(","))):
+            for name in _images:
+                load(name, request_profile({"X-Frame-Size": f"{frame[0]}x{frame[1]}"}))
+            print(f"  {len(_images)} images queued for {frame[0]}x{frame[1]}")
     print(f"\nListening on {args.host}:{args.port}  (Ctrl+C to stop)\n")
 
-    server = HTTPServer((args.host, args.port), ImageHandler)
+    server = ImageServer((args.host, args.port), ImageHandler)
     try:
         server.serve_forever()
     except KeyboardInterrupt:
@@ -0,0 +1,234 @@
+"""
+JPEG variants for webserver/server.py: an image encoded for one kind of frame.
+
+A variant is the source scaled to cover the frame and center-cropped (like prepare_assets.sh),
+encoded by ImageMagick at a given quality, baseline or progressive, with a given chroma
+subsampling. Each encoding is cached under the source's hash and that profile, in memory and
+on disk, both least recently used first out; a restarted server finds its variants again.
+
+Encoding runs on a pool of worker threads (each waits on a convert process, so they use all
+cores), so a request never waits for one unless nothing else fits the device: the server sends
+what it has and the variant is there next time.
+"""
+
+import collections
+import hashlib
+import os
+import re
+import shutil
+import subprocess
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
+QUALITY_MIN  = 25   # lowest quality tried to fit X-Max-Bytes
+QUALITY_STEP = 10
+SAMPLING     = ("4:2:0", "4:2:2", "4:4:4")
+
+Profile = collections.namedtuple("Profile", "width height quality progressive sampling")
+
+
+def jpeg_size(data):
+    """(width, height) from the frame header, None if it isn't a JPEG"""
+    if data[:2] != b"\xff\xd8":
+        return None
+    i = 2
+    while i + 9 <= len(data) and data[i] == 0xFF:
+        marker = data[i + 1]
+        if marker in (0xC0, 0xC1, 0xC2, 0xC3, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xCB, 0xCD, 0xCE, 0xCF):
+            return int.from_bytes(data[i + 7:i + 9], "big"), int.from_bytes(data[i + 5:i + 7], "big")
+        i += 2 + int.from_bytes(data[i + 2:i + 4], "big")
+    return None
+
+
+def fits(data, max_bytes, frame):
+    """No more bytes than the device takes, no more pixels than its frame shows"""
+    size = jpeg_size(data) if frame else None
+    return ((max_bytes is None or len(data) <= max_bytes)
+            and (size is None or (size[0] <= frame[0] and size[1] <= frame[1])))
+
+
+def profile_name(p):
+    return f"{p.width}x{p.height}-q{p.quality}-{'prog' if p.progressive else 'base'}-{p.sampling.replace(':', '')}"
+
+
+def ladder(p):
+    """p, then the same at lower qualities, down to QUALITY_MIN"""
+    return [p._replace(quality=q) for q in range(p.quality, QUALITY_MIN - 1, -QUALITY_STEP)] or [p]
+
+
+def encode(data, p):
+    """data as p, None if convert fails. Never scales up: a source smaller than the frame keeps its size"""
+    size = jpeg_size(data)
+    geometry = []
+    if size is None or size[0] > p.width or size[1] > p.height:
+        geometry = ["-resize", f"{p.width}x{p.height}^", "-gravity", "Center", "-extent", f"{p.width}x{p.height}"]
+    out = subprocess.run(["convert", "-", *geometry, "-quality", str(p.quality),
+                          "-interlace", "JPEG" if p.progressive else "None",
+                          "-sampling-factor", p.sampling, "-strip", "jpg:-"],
+                         input=data, capture_output=True).stdout
+    return out or None
+
+
+class LRU:
+    """Least recently used first out, bounded by the bytes held"""
+
+    def __init__(self, limit):
+        self.limit = limit
+        self.bytes = 0
+        self.entries = collections.OrderedDict()
+        self.lock = threading.Lock()
+
+    def get(self, key):
+        with self.lock:
+            value = self.entries.get(key)
+            if value is not None:
+                self.entries.move_to_end(key)
+            return value
+
+    def put(self, key, value, size):
+        with self.lock:
+            old = self.entries.pop(key, None)
+            if old is not None:
+                self.bytes -= old[1]
+            self.entries[key] = (value, size)
+            self.bytes += size
+            while self.bytes > self.limit and len(self.entries) > 1:
+                self.bytes -= self.entries.popitem(last=False)[1][1]
+
+    def __len__(self):
+        return len(self.entries)
+
+
+class DiskCache:
+    """Variants as files named by source hash and profile, the oldest (by mtime, refreshed on every hit)
+    deleted once the directory holds more than limit bytes"""
+
+    def __init__(self, path, limit):
+        self.path = path
+        self.limit = limit
+        self.lock = threading.Lock()
+        os.makedirs(path, exist_ok=True)
+        with self.lock:
+            self.trim()
+
+    def file(self, key):
+        return os.path.join(self.path, f"{key[0]}-{profile_name(key[1])}.jpg")
+
+    def get(self, key):
+        try:
+            with open(self.file(key), "rb") as f:
+                data = f.read()
+            os.utime(self.file(key))
+            return data
+        except OSError:
+            return None
+
+    def put(self, key, data):
+        tmp = self.file(key) + f".{threading.get_ident()}.tmp"
+        with open(tmp, "wb") as f:
+            f.write(data)
+        os.replace(tmp, self.file(key))
+        with self.lock:
+            self.bytes += len(data)
+            if self.bytes > self.limit:
+                self.trim()
+
+    def trim(self):
+        files = sorted(((e.stat().st_mtime, e.stat().st_size, e.path) for e in os.scandir(self.path)
+                        if e.name.endswith(".jpg")))
+        self.bytes = sum(f[1] for f in files)
+        for _, size, path in files:
+            if self.bytes <= self.limit:
+                break
+            self.bytes -= size
+            os.remove(path)
+
+
+class Variants:
+    """Encodings of source images, by source hash and profile"""
+
+    def __init__(self, workers, memory_bytes, disk_dir=None, disk_bytes=0):
+        self.available = shutil.which("convert") is not None
+        self.memory = LRU(memory_bytes)
+        self.disk = DiskCache(disk_dir, disk_bytes) if disk_dir and self.available else None
+        self.pool = ThreadPoolExecutor(max_workers=workers, thread_name_prefix="encode")
+        self.workers = workers
+        self.pending = {}                   # (source hash, max bytes, frame, profile) -> Future
+        self.lock = threading.Lock()
+        self.stats = collections.Counter()  # memory hits, disk hits, encodes
+
+    def cached(self, key):
+        """(bytes, ETag) of one encoding if in memory or on disk, None otherwise"""
+        v = self.memory.get(key)
+        if v is not None:
+            self.stats["memory hits"] += 1
+            return v[0]
+        data = self.disk.get(key) if self.disk else None
+        if data is None:
+            return None
+        self.stats["disk hits"] += 1
+        v = (data, '"' + hashlib.sha256(data).hexdigest()[:32] + '"')
+        self.memory.put(key, v, len(data))
+        return v
+
+    def encoded(self, source_hash, data, p):
+        v = self.cached((source_hash, p))
+        if v is None:
+            out = encode(data, p)
+            if out is None:
+                return None
+            self.stats["encodes"] += 1
+            v = (out, '"' + hashlib.sha256(out).hexdigest()[:32] + '"')
+            self.memory.put((source_hash, p), v, len(out))
+            if self.disk:
+                self.disk.put((source_hash, p), out)
+        return v
+
+    def best(self, source_hash, data, p, max_bytes, frame, encode_missing):
+        """(bytes, ETag, profile) at the highest quality of p's ladder that fits, None if none does.
+        Without encode_missing only what is cached counts, and a missing step ends the search: False"""
+        for step in ladder(p):
+            v = self.encoded(source_hash, data, step) if encode_missing else self.cached((source_hash, step))
+            if v is None:
+                return False if not encode_missing else None
+            if fits(v[0], max_bytes, frame):
+                return v[0], v[1], step
+        return None
+
+    def get(self, source_hash, data, p, max_bytes, frame, wait=None):
+        """Variant of the source for p that fits: (bytes, ETag, profile), None if none does. If it has to be
+        encoded first, that's queued and False returned right away, or after waiting up to wait seconds"""
+        found = self.best(source_hash, data, p, max_bytes, frame, False)
+        if found is not False or not self.available:
+            return found or None
+        job = (source_hash, max_bytes, frame, p)
+        with self.lock:
+            future = self.pending.get(job)
+            if future is None:
+                future = self.pool.submit(self.best, source_hash, data, p, max_bytes, frame, True)
+                future.add_done_callback(lambda f: self.done(job))
+                self.pending[job] = future
+        if wait is None:
+            return False
+        try:
+            return future.result(timeout=wait)
+        except Exception:
+            return False
+
+    def done(self, job):
+        with self.lock:
+            self.pending.pop(job, None)
+
+    def status(self):
+        with self.lock:
+            queued = len(self.pending)
+        disk = f", disk {self.disk.bytes // 1024:,} kB in {self.disk.path}" if self.disk else ""
+        return (f"{len(self.memory)} encodings, {self.memory.bytes // 1024:,} kB in memory{disk}; "
+                f"{self.stats['memory hits']} memory hits, {self.stats['disk hits']} disk hits, "
+                f"{self.stats['encodes']} encoded, {queued} queued")
+
+
+def parse_frame(text):
+    """"800x600" -> (800, 600), None if it isn't one"""
+    m = re.fullmatch(r"(\d+)x(\d+)", (text or "").strip())
+    return (int(m.group(1)), int(m.group(2))) if m and int(m.group(1)) and int(m.group(2)) else None